@@ -6,11 +6,14 @@
 #include "base/valRef.h"
 #include "types/allVals.h"
 #include "utils/ignoreUnused.h"
+#include "utils/recycleList.h"
 using namespace std;
-bool sanityCheckRepeatMode = true;
-bool hashCheckRepeatMode = true;
-int TriggerDepthTracker::globalDepth = -1;
-UInt64 triggerEventCount = 0;
+thread_local bool sanityCheckRepeatMode = true;
+thread_local bool hashCheckRepeatMode = true;
+thread_local int TriggerDepthTracker::globalDepth = -1;
+thread_local UInt64 triggerEventCount = 0;
+thread_local PeekContext peekContext;
+thread_local RecycleStats recycleStats;
 UInt LARGE_VIOLATION = ((UInt)1) << ((sizeof(UInt) * 4) - 1);
 UInt MAX_DOMAIN_SIZE = numeric_limits<UInt>().max();
 BoolValue makeViolatingBoolValue() {
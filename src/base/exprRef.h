@@ -19,8 +19,8 @@ using std::experimental::make_optional;
 using std::experimental::nullopt;
 using std::experimental::optional;
 }  // namespace lib
-extern bool sanityCheckRepeatMode;
-extern bool hashCheckRepeatMode;
+extern thread_local bool sanityCheckRepeatMode;
+extern thread_local bool hashCheckRepeatMode;
 extern bool repeatSanityCheckOfConst;
 extern bool dontSkipSanityCheckForAlreadyVisitedChildren;
 extern bool verboseSanityError;
@@ -375,7 +375,14 @@ bool optimise(ExprRef<View>& expr, bool markAsCondition) {
 
 struct ViolationContext {
     UInt parentViolation;
+    // set if parentViolation is the violation of the whole model, passed down
+    // unchanged.  Variables reached with such a context mark the container,
+    // see VarViolationTracker.
+    bool isModelViolation = false;
     ViolationContext(UInt parentViolation) : parentViolation(parentViolation) {}
+    ViolationContext(UInt parentViolation, bool isModelViolation)
+        : parentViolation(parentViolation),
+          isModelViolation(isModelViolation) {}
     virtual ~ViolationContext() {}
 };
 
@@ -0,0 +1,133 @@
+#ifndef SRC_BASE_PEEK_H_
+#define SRC_BASE_PEEK_H_
+#include <functional>
+
+#include "base/intSize.h"
+#include "utils/hashUtils.h"
+
+// Speculative evaluation of moves (--peek-moves).  Rather than applying a
+// change, asking the strategy and undoing the change if it is rejected, a
+// neighbourhood may first ask the triggers of the changing variable to peek at
+// the change.  An operator that supports peeking computes the value (or
+// violation) it would have from the hypothetical values of its operands,
+// records it here without touching its own state and passes the peek on to its
+// own triggers.  The strategy then decides on the hypothetical violation and
+// objective of the model and the change is only applied if accepted.
+// Triggers that can not peek return false, the neighbourhood then falls back to
+// apply and undo.
+// An operator reached by more than one path is peeked once per path, each time
+// recomputing from the latest hypothetical values of its operands.  Operators
+// that update their value incrementally record the hypothetical entries of
+// their caches as slots, so that each operand is only counted once.
+
+struct PeekKey {
+    const void* owner;
+    UInt64 key;
+    inline bool operator==(const PeekKey& other) const {
+        return owner == other.owner && key == other.key;
+    }
+};
+
+// an entry of a cache keyed by value hash
+struct PeekHashKey {
+    const void* owner;
+    HashType key;
+    inline bool operator==(const PeekHashKey& other) const {
+        return owner == other.owner && key == other.key;
+    }
+};
+
+namespace std {
+template <>
+struct hash<PeekKey> {
+    inline size_t operator()(const PeekKey& peekKey) const {
+        return hash<const void*>()(peekKey.owner) ^
+               (peekKey.key * 0x9e3779b97f4a7c15ull);
+    }
+};
+template <>
+struct hash<PeekHashKey> {
+    inline size_t operator()(const PeekHashKey& peekKey) const {
+        return hash<const void*>()(peekKey.owner) ^
+               (hash<HashType>()(peekKey.key) * 0x9e3779b97f4a7c15ull);
+    }
+};
+}  // namespace std
+
+class PeekContext {
+    bool peeking = false;
+    // hypothetical Int values and violations, keyed by the address of the view
+    HashMap<const void*, Int> values;
+    HashMap<PeekKey, Int> slots;
+    // the same for operators that index their operands by value hash
+    HashMap<PeekKey, HashType> hashSlots;
+    HashMap<PeekHashKey, Int> hashKeyedSlots;
+
+   public:
+    inline bool active() const { return peeking; }
+    inline void begin() {
+        values.clear();
+        slots.clear();
+        hashSlots.clear();
+        hashKeyedSlots.clear();
+        peeking = true;
+    }
+    inline void end() { peeking = false; }
+
+    // the hypothetical value of view, actualValue if it has not been peeked
+    inline Int valueOf(const void* view, Int actualValue) const {
+        auto iter = values.find(view);
+        return (iter == values.end()) ? actualValue : iter->second;
+    }
+    inline void setValue(const void* view, Int value) { values[view] = value; }
+
+    // the hypothetical value of entry key of the cache owner, actualValue if it
+    // has not been peeked
+    inline Int slot(const void* owner, UInt64 key, Int actualValue) const {
+        auto iter = slots.find(PeekKey{owner, key});
+        return (iter == slots.end()) ? actualValue : iter->second;
+    }
+    inline void setSlot(const void* owner, UInt64 key, Int value) {
+        slots[PeekKey{owner, key}] = value;
+    }
+    // sets the hypothetical value of entry key of the cache owner, returning
+    // its previous hypothetical value
+    inline Int exchangeSlot(const void* owner, UInt64 key, Int actualValue,
+                            Int newValue) {
+        auto& value =
+            slots.emplace(PeekKey{owner, key}, actualValue).first->second;
+        Int oldValue = value;
+        value = newValue;
+        return oldValue;
+    }
+
+    // as above, for entries that are hashes or that are keyed by a hash
+    inline Int slot(const void* owner, HashType key, Int actualValue) const {
+        auto iter = hashKeyedSlots.find(PeekHashKey{owner, key});
+        return (iter == hashKeyedSlots.end()) ? actualValue : iter->second;
+    }
+    inline void setSlot(const void* owner, HashType key, Int value) {
+        hashKeyedSlots[PeekHashKey{owner, key}] = value;
+    }
+    inline HashType exchangeHashSlot(const void* owner, UInt64 key,
+                                     HashType actualValue, HashType newValue) {
+        auto& value =
+            hashSlots.emplace(PeekKey{owner, key}, actualValue).first->second;
+        HashType oldValue = value;
+        value = newValue;
+        return oldValue;
+    }
+};
+
+extern thread_local PeekContext peekContext;
+
+// the peek context is active for the life time of this object
+class PeekScope {
+   public:
+    PeekScope() { peekContext.begin(); }
+    ~PeekScope() { peekContext.end(); }
+    PeekScope(const PeekScope&) = delete;
+    PeekScope& operator=(const PeekScope&) = delete;
+};
+
+#endif /* SRC_BASE_PEEK_H_ */
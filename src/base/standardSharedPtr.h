@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "common/common.h"
+#include "utils/poolAllocator.h"
 template <typename T>
 class StandardSharedPtr {
    public:
@@ -0,0 +1,145 @@
+#include "base/triggerProfiler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+using namespace std;
+
+bool profileTriggers = false;
+thread_local TriggerProfiler triggerProfiler;
+
+UInt TriggerProfiler::getLabelId(const string& label) {
+    auto iter = labelIds.find(label);
+    if (iter != labelIds.end()) {
+        return iter->second;
+    }
+    UInt id = labels.size();
+    labels.emplace_back(label);
+    labelIds.emplace(label, id);
+    return id;
+}
+
+string TriggerProfiler::path(size_t index) const {
+    const Node& node = nodes[index];
+    if (node.parent == 0) {
+        return labels[node.label];
+    }
+    return path(node.parent) + ";" + labels[node.label];
+}
+
+void TriggerProfiler::printFoldedStacks(ostream& os) const {
+    // triggers of different types may belong to the same operator, their
+    // paths are merged
+    map<string, UInt64> selfTicks;
+    for (size_t i = 1; i < nodes.size(); i++) {
+        UInt64 ticks = nodes[i].ticks - nodes[i].childTicks;
+        if (ticks > 0) {
+            selfTicks[path(i)] += ticks;
+        }
+    }
+    for (auto& pathTicksPair : selfTicks) {
+        os << pathTicksPair.first << " " << pathTicksPair.second << "\n";
+    }
+}
+
+namespace {
+struct LabelSummary {
+    bool isNeighbourhood = false;
+    UInt64 calls = 0;
+    UInt64 selfTicks = 0;
+    UInt64 ticks = 0;
+};
+}  // namespace
+
+void TriggerProfiler::printSummary(ostream& os) const {
+    vector<LabelSummary> summaries(labels.size());
+    UInt64 totalSelfTicks = 0;
+    for (size_t i = 1; i < nodes.size(); i++) {
+        const Node& node = nodes[i];
+        auto& summary = summaries[node.label];
+        summary.isNeighbourhood = node.isNeighbourhood;
+        summary.calls += node.calls;
+        summary.selfTicks += node.ticks - node.childTicks;
+        totalSelfTicks += node.ticks - node.childTicks;
+        // time in recursive calls is already included in the outer most call
+        size_t ancestor = node.parent;
+        while (ancestor != 0 && nodes[ancestor].label != node.label) {
+            ancestor = nodes[ancestor].parent;
+        }
+        if (ancestor == 0) {
+            summary.ticks += node.ticks;
+        }
+    }
+    vector<UInt> order;
+    for (UInt i = 1; i < summaries.size(); i++) {
+        order.push_back(i);
+    }
+    sort(order.begin(), order.end(), [&](UInt u, UInt v) {
+        return summaries[u].selfTicks > summaries[v].selfTicks;
+    });
+    os << "kind,name,calls,selfTicks,totalTicks,selfPercent\n";
+    for (UInt label : order) {
+        auto& summary = summaries[label];
+        double selfPercent =
+            (totalSelfTicks == 0)
+                ? 0
+                : (100.0 * summary.selfTicks) / totalSelfTicks;
+        os << ((summary.isNeighbourhood) ? "neighbourhood" : "operator")
+           << "," << labels[label] << "," << summary.calls << ","
+           << summary.selfTicks << "," << summary.ticks << "," << selfPercent
+           << "\n";
+    }
+}
+
+static string demangle(const char* name) {
+#ifdef __GNUG__
+    int status = 0;
+    unique_ptr<char, void (*)(void*)> demangled(
+        abi::__cxa_demangle(name, nullptr, nullptr, &status), free);
+    if (status == 0) {
+        return demangled.get();
+    }
+#endif
+    return name;
+}
+
+static bool isIdentifierChar(char c) { return isalnum(c) || c == '_'; }
+
+string triggerLabel(const type_info& triggerType) {
+    string name = demangle(triggerType.name());
+    // the triggers of quantifiers are named after what they watch
+    for (const char* quantifierTrigger :
+         {"ExprChangeTrigger", "ConditionChangeTrigger", "ContainerTrigger"}) {
+        if (name.compare(0, strlen(quantifierTrigger), quantifierTrigger) ==
+            0) {
+            return "Quantifier";
+        }
+    }
+    // other triggers are either nested in their operator's class or have the
+    // operator as a template argument, take the first operator name
+    for (size_t i = 0; i + 2 < name.size(); i++) {
+        if ((i == 0 || !isIdentifierChar(name[i - 1])) && name[i] == 'O' &&
+            name[i + 1] == 'p' && isupper(name[i + 2])) {
+            size_t end = i + 2;
+            while (end < name.size() && isIdentifierChar(name[end])) {
+                ++end;
+            }
+            return name.substr(i, end - i);
+        }
+    }
+    const string anonymousNamespace = "(anonymous namespace)::";
+    if (name.compare(0, anonymousNamespace.size(), anonymousNamespace) == 0) {
+        name.erase(0, anonymousNamespace.size());
+    }
+    // keep the labels free of the separators of the folded stack format
+    name.erase(remove_if(name.begin(), name.end(),
+                         [](char c) { return c == ' ' || c == ';'; }),
+               name.end());
+    return name;
+}
@@ -0,0 +1,128 @@
+#ifndef SRC_BASE_TRIGGERPROFILER_H_
+#define SRC_BASE_TRIGGERPROFILER_H_
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "base/intSize.h"
+
+// Profiling of trigger propagation (--profile).  Each call of a trigger by
+// visitTriggers is a frame, labelled with the operator that owns the trigger.
+// Frames entered whilst another frame is running are its children, so the
+// frames form a tree of propagation paths, each path being a chain of
+// expression nodes through which a change travelled.  The roots of the tree
+// are the neighbourhoods that made the changes.  Every node of the tree counts
+// its calls and the ticks spent in it, read from the time stamp counter where
+// there is one and the steady clock (in nanoseconds) otherwise.
+extern bool profileTriggers;
+
+class TriggerProfiler {
+    struct Node {
+        const void* key;
+        UInt label;
+        bool isNeighbourhood;
+        size_t parent;
+        UInt64 calls = 0;
+        // ticks spent in this node, including its children
+        UInt64 ticks = 0;
+        UInt64 childTicks = 0;
+        std::vector<size_t> children;
+        Node(const void* key, UInt label, bool isNeighbourhood, size_t parent)
+            : key(key),
+              label(label),
+              isNeighbourhood(isNeighbourhood),
+              parent(parent) {}
+    };
+    // nodes[0] is the root, it is never entered
+    std::vector<Node> nodes = {Node(nullptr, 0, false, 0)};
+    std::vector<std::string> labels = {"root"};
+    std::unordered_map<std::string, UInt> labelIds;
+    size_t current = 0;
+
+    UInt getLabelId(const std::string& label);
+    std::string path(size_t index) const;
+
+   public:
+    static inline UInt64 now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    // make the child of the current node with the given key the current
+    // node, returning the previous current node.  makeLabel is only called
+    // the first time a key is seen at this point in the tree.
+    template <typename MakeLabel>
+    inline size_t enter(const void* key, bool isNeighbourhood,
+                        MakeLabel&& makeLabel) {
+        size_t parent = current;
+        for (size_t child : nodes[parent].children) {
+            if (nodes[child].key == key) {
+                current = child;
+                return parent;
+            }
+        }
+        UInt label = getLabelId(makeLabel());
+        current = nodes.size();
+        nodes.emplace_back(key, label, isNeighbourhood, parent);
+        nodes[parent].children.push_back(current);
+        return parent;
+    }
+
+    inline void exit(size_t parent, UInt64 ticks) {
+        Node& node = nodes[current];
+        ++node.calls;
+        node.ticks += ticks;
+        nodes[parent].childTicks += ticks;
+        current = parent;
+    }
+
+    // one line per propagation path, the labels of the path separated by
+    // semicolons followed by the ticks spent in the last node of the path.
+    // This is the folded stack format read by flame graph tools.
+    void printFoldedStacks(std::ostream& os) const;
+    // CSV of the calls and ticks of each neighbourhood and operator
+    void printSummary(std::ostream& os) const;
+};
+
+extern thread_local TriggerProfiler triggerProfiler;
+
+// name of the operator owning a trigger of the given type
+std::string triggerLabel(const std::type_info& triggerType);
+
+// times the enclosing scope as a frame of triggerProfiler, does nothing if
+// profileTriggers is not set
+class ProfiledFrame {
+    bool active;
+    size_t parent = 0;
+    UInt64 start = 0;
+
+   public:
+    template <typename MakeLabel>
+    ProfiledFrame(const void* key, bool isNeighbourhood, MakeLabel&& makeLabel)
+        : active(profileTriggers) {
+        if (active) {
+            parent = triggerProfiler.enter(key, isNeighbourhood, makeLabel);
+            start = TriggerProfiler::now();
+        }
+    }
+    ProfiledFrame(const ProfiledFrame&) = delete;
+    ProfiledFrame& operator=(const ProfiledFrame&) = delete;
+    ~ProfiledFrame() {
+        if (active) {
+            triggerProfiler.exit(parent, TriggerProfiler::now() - start);
+        }
+    }
+};
+
+#endif /* SRC_BASE_TRIGGERPROFILER_H_ */
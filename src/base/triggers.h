@@ -1,15 +1,20 @@
 
 #ifndef SRC_BASE_TRIGGERS_H_
 #define SRC_BASE_TRIGGERS_H_
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 #include "base/exprRef.h"
+#include "base/peek.h"
+#include "base/triggerProfiler.h"
 #include "base/typeDecls.h"
 #include "utils/flagSet.h"
 #include "utils/ignoreUnused.h"
 template <typename T>
 struct ExprRef;
-extern UInt64 triggerEventCount;
+extern thread_local UInt64 triggerEventCount;
 struct TriggerBase {
    private:
     bool _active = true;
@@ -23,6 +28,10 @@ struct TriggerBase {
     virtual void hasBecomeUndefined() = 0;
     virtual void hasBecomeDefined() = 0;
     virtual void memberReplaced(UInt index, const AnyExprRef& oldMember) = 0;
+    // speculative evaluation, see base/peek.h.  Returns false if the
+    // trigger can not compute the effect of the change without it being
+    // applied.
+    virtual bool peekValueChanged() { return false; }
 };
 
 static const size_t MIN_CLEAN_SIZE = 16;
@@ -30,11 +39,14 @@ static const size_t MIN_CLEAN_SIZE = 16;
 template <typename T>
 class TriggerQueue;
 
+// Triggers are stored contiguously.  Deleted triggers are only marked
+// inactive (see deleteTrigger), they are compacted out of the queue by the
+// outer most visit of the queue or when the queue grows.
 template <typename T>
 class TriggerQueue {
     bool currentlyProcessing = false;
     size_t lastCleanSize = 0;
-    std::deque<std::shared_ptr<T>> triggers;
+    std::vector<std::shared_ptr<T>> triggers;
 
    public:
     struct QueueAccess {
@@ -45,7 +57,7 @@ class TriggerQueue {
         bool firstAccess;
 
        public:
-        std::deque<std::shared_ptr<T>>& triggers;
+        std::vector<std::shared_ptr<T>>& triggers;
 
        private:
         QueueAccess(TriggerQueue<T>& queue)
@@ -60,14 +72,18 @@ class TriggerQueue {
                 queue.currentlyProcessing = false;
             }
         }
+        // true if no other visit of this queue is in progress, in which case
+        // triggers may be moved or removed
+        inline bool outerMostAccess() const { return firstAccess; }
     };
 
    public:
     inline QueueAccess access() { return QueueAccess(*this); }
 
     void takeFrom(TriggerQueue<T>& other) {
-        triggers.insert(triggers.end(), other.triggers.begin(),
-                        other.triggers.end());
+        triggers.insert(triggers.end(),
+                        std::make_move_iterator(other.triggers.begin()),
+                        std::make_move_iterator(other.triggers.end()));
         other.triggers.clear();
     }
     template <typename Trigger>
@@ -80,20 +96,11 @@ class TriggerQueue {
     }
 
     void cleanNullTriggers(bool includeInactive = false) {
-        for (size_t i = 0; i < triggers.size(); ++i) {
-            if (triggers[i] && (!includeInactive || triggers[i]->active())) {
-                continue;
-            }
-            while (!triggers.empty() && !triggers.back()) {
-                triggers.pop_back();
-            }
-            if (i >= triggers.size()) {
-                break;
-            } else {
-                triggers[i] = std::move(triggers.back());
-                triggers.pop_back();
-            }
-        }
+        auto newEnd = std::remove_if(
+            triggers.begin(), triggers.end(), [&](const auto& trigger) {
+                return !trigger || (includeInactive && !trigger->active());
+            });
+        triggers.erase(newEnd, triggers.end());
         lastCleanSize = triggers.size();
     }
 };
@@ -127,7 +134,7 @@ void handleTriggerAdd(const std::shared_ptr<Trigger>& trigger,
 }
 
 class TriggerDepthTracker {
-    static int globalDepth;
+    static thread_local int globalDepth;
 
    public:
     TriggerDepthTracker() { ++globalDepth; }
@@ -137,27 +144,71 @@ class TriggerDepthTracker {
 };
 
 void handleDefinedVarTriggers();
+
+// Batched propagation (--batch-triggers).  Whilst a batch is open, the
+// subsequenceChanged events of batchable sequence operators are collected per
+// operator, merging overlapping ranges, and are only forwarded to the parents
+// when the batch is flushed.
+extern bool batchTriggerPropagation;
+extern thread_local bool triggerBatchOpen;
+// opens a batch if batchTriggerPropagation is set
+void openTriggerBatch();
+// forwards all collected events, the batch remains open
+void flushBatchedTriggers();
+void closeTriggerBatch();
+
+template <typename Visitor, typename Trigger>
+inline void callTrigger(Visitor& func, Trigger* trigger) {
+    ++triggerEventCount;
+    if (profileTriggers) {
+        const std::type_info& triggerType = typeid(*trigger);
+        ProfiledFrame frame(&triggerType, false,
+                            [&]() { return triggerLabel(triggerType); });
+        func(trigger);
+    } else {
+        func(trigger);
+    }
+}
+
 template <typename Visitor, typename Trigger>
 void visitTriggers(Visitor&& func, TriggerQueue<Trigger>& queue) {
     TriggerDepthTracker triggerDepth;
     auto access = queue.access();
-
-    size_t size = access.triggers.size();
-    size_t triggerNullCount = 0;
+    auto& triggers = access.triggers;
     // triggers may be changed, insure that new triggers are ignored
-    for (size_t i = 0; i < size && i < access.triggers.size(); i++) {
-        auto& trigger = access.triggers[i];
-        if (trigger && trigger->active()) {
-            ++triggerEventCount;
-            func(trigger);
-        } else {
-            ++triggerNullCount;
-            trigger = nullptr;
+    size_t size = triggers.size();
+    if (!access.outerMostAccess()) {
+        // the queue is already being visited further up the stack, so only
+        // the outer most visit may move triggers.
+        for (size_t i = 0; i < size && i < triggers.size(); i++) {
+            Trigger* trigger = triggers[i].get();
+            if (trigger && trigger->active()) {
+                callTrigger(func, trigger);
+            }
+        }
+    } else {
+        // visit the active triggers, at the same time compacting them to the
+        // front of the queue, dropping inactive ones.  The triggers are
+        // accessed through raw pointers as func may add triggers to this
+        // queue, reallocating it.
+        size_t numberActive = 0;
+        for (size_t i = 0; i < size && i < triggers.size(); i++) {
+            if (!triggers[i] || !triggers[i]->active()) {
+                continue;
+            }
+            if (numberActive != i) {
+                triggers[numberActive] = std::move(triggers[i]);
+            }
+            Trigger* trigger = triggers[numberActive].get();
+            ++numberActive;
+            callTrigger(func, trigger);
+        }
+        if (numberActive < size && size <= triggers.size()) {
+            // keep triggers that were added during the visit
+            auto newEnd = std::move(triggers.begin() + size, triggers.end(),
+                                    triggers.begin() + numberActive);
+            triggers.erase(newEnd, triggers.end());
         }
-    }
-    if (access.triggers.size() > MIN_CLEAN_SIZE &&
-        ((double)triggerNullCount) / access.triggers.size() > 0.5) {
-        queue.cleanNullTriggers();
     }
     if (triggerDepth.atBottom()) {
         // outer most visit triggers call
@@ -165,6 +216,24 @@ void visitTriggers(Visitor&& func, TriggerQueue<Trigger>& queue) {
     }
 }
 
+// speculative evaluation, see base/peek.h.  Calls func on each active
+// trigger, stopping at the first trigger that could not peek.
+template <typename Visitor, typename Trigger>
+bool peekTriggers(Visitor&& func, TriggerQueue<Trigger>& queue) {
+    auto access = queue.access();
+    auto& triggers = access.triggers;
+    for (size_t i = 0; i < triggers.size(); i++) {
+        Trigger* trigger = triggers[i].get();
+        if (trigger && trigger->active()) {
+            ++triggerEventCount;
+            if (!func(trigger)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 template <typename Trigger>
 void deleteTrigger(const std::shared_ptr<Trigger>& trigger) {
     if (trigger) {
@@ -203,6 +272,11 @@ struct ChangeTriggerAdapterBase
         static_cast<Child*>(this)->adapterValueChanged();
     }
     void valueChanged() { this->forwardValueChanged(); }
+    bool peekValueChanged() override {
+        return static_cast<Child*>(this)->adapterPeekValueChanged();
+    }
+    // hidden by children that support peeking
+    bool adapterPeekValueChanged() { return false; }
 };
 
 template <typename TriggerType, typename Child>
@@ -257,6 +331,10 @@ struct TriggerContainerBase {
         visitTriggers([&](auto& t) { t->hasBecomeUndefined(); },
                       static_cast<Derived&>(*this).triggers);
     }
+    bool notifyPeekValueChanged() {
+        return peekTriggers([&](auto& t) { return t->peekValueChanged(); },
+                            static_cast<Derived&>(*this).triggers);
+    }
     void notifyReattachTrigger() {
         visitTriggers([&](auto& t) { t->reattachTrigger(); },
                       static_cast<Derived&>(*this).triggers);
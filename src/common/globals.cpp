@@ -0,0 +1,40 @@
+// The settings and state that main.cpp sets from the command line and that
+// the rest of the solver reads.  They are defined here rather than in main.cpp
+// so that other executables built from the sources, such as athanor_bench,
+// link against the same definitions.
+#include <atomic>
+#include <string>
+
+#include "base/intSize.h"
+#include "utils/hashUtils.h"
+#include "utils/random.h"
+
+thread_local RandomGenerator globalRandomGenerator;
+RandomGeneratorType randomGeneratorType = RandomGeneratorType::XOSHIRO256;
+HashFunction hashFunction = HashFunction::WORD_MIX;
+
+std::string bestSolution;
+bool saveBestSolution = false;
+bool noPrintSolutions = false;
+bool quietMode = true;
+
+bool hasIterationLimit = false;
+UInt64 iterationLimit = 0;
+bool hasSolutionLimit = false;
+UInt64 solutionLimit = 0;
+std::atomic<bool> sigIntActivated(false), sigAlarmActivated(false);
+
+UInt64 improveStratPeakIterations = 5000;
+double DEFAULT_UCB_EXPLORATION_BIAS = 1;
+UInt allowedViolation = 0;
+bool allowForwardingOfDefiningExprs = true;
+bool shouldRunHashChecks = false;
+
+bool runSanityChecks = false;
+bool verboseSanityError = false;
+bool repeatSanityCheckOfConst = false;
+bool dontSkipSanityCheckForAlreadyVisitedChildren = false;
+UInt64 sanityCheckInterval = 1;
+#ifdef DEBUG_MODE
+bool debugLogAllowed = true;
+#endif
@@ -1,21 +1,27 @@
 #include <autoArgParse/argParser.h>
+#include <sys/resource.h>
 #include <sys/time.h>
 
 #include <csignal>
 #include <fstream>
 #include <iostream>
 #include <json.hpp>
+#include <random>
 #include <unordered_map>
 
+#include "base/triggerProfiler.h"
 #include "common/common.h"
 #include "gitRevision.h"
 #include "parsing/jsonModelParser.h"
+#include "parsing/modelCache.h"
 #include "search/exploreStrategies.h"
 #include "search/improveStrategies.h"
 #include "search/neighbourhoodSelectionStrategies.h"
+#include "search/portfolio.h"
 #include "search/solver.h"
 #include "utils/getExecPath.h"
 #include "utils/hashUtils.h"
+#include "utils/recycleList.h"
 #include "utils/runCommand.h"
 #ifdef WASM_TARGET
 #include <emscripten/bind.h>
@@ -88,7 +94,16 @@ auto& conjurePathArg =
             "reported and athanor will exit.")
         .add<Arg<string>>("path_to_conjure_executable", Policy::MANDATORY, "");
 
-mt19937 globalRandomGenerator;
+auto& modelCacheFlag = inputGroup.add<ComplexFlag>(
+    "--model-cache", Policy::OPTIONAL,
+    "Cache the JSON translations of essence and param files, so that "
+    "repeated runs on the same files do not run conjure.  Entries are keyed "
+    "by the contents of the files, clear the cache after upgrading conjure.");
+auto& modelCacheArg = modelCacheFlag.add<Arg<string>>(
+    "path_to_directory", Policy::MANDATORY,
+    "Directory holding the cache, created if it does not exist.");
+
+extern thread_local RandomGenerator globalRandomGenerator;
 auto& randomSeedFlag = inputGroup.add<ComplexFlag>(
     "--random-seed", Policy::OPTIONAL, "Specify a random seed.");
 auto& seedArg = randomSeedFlag.add<Arg<unsigned int>>(
@@ -99,8 +114,6 @@ auto& outputGroup = argParser.makePrintGroup(
     "output", "Saving solutions, viewing search progress and saving stats.");
 extern string bestSolution;
 extern bool saveBestSolution;
-string bestSolution;
-bool saveBestSolution = false;
 
 auto& saveBestSolutionFlag = outputGroup.add<ComplexFlag>(
     "--save-best-solution", Policy::OPTIONAL,
@@ -131,8 +144,8 @@ auto& realTimeLimitFlag = searchLimitsGroup.add<ComplexFlag>(
 
 auto& realTimeLimitArg =
     realTimeLimitFlag.add<Arg<int>>("number_seconds", Policy::MANDATORY, "");
-bool hasIterationLimit = false;
-UInt64 iterationLimit = 0;
+extern bool hasIterationLimit;
+extern UInt64 iterationLimit;
 auto& iterationLimitFlag = searchLimitsGroup.add<ComplexFlag>(
     "--iteration-limit", Policy::OPTIONAL,
     "Specify the maximum number of iterations to spend in search.");
@@ -145,8 +158,8 @@ auto& iterationLimitArg = iterationLimitFlag.add<Arg<UInt64>>(
         return value;
     }));
 
-bool hasSolutionLimit = false;
-UInt64 solutionLimit = 0;
+extern bool hasSolutionLimit;
+extern UInt64 solutionLimit;
 auto& solutionLimitFlag = searchLimitsGroup.add<ComplexFlag>(
     "--solution-limit", Policy::OPTIONAL,
     "Exit search if the specified number of solutions has been found.  Note, "
@@ -165,14 +178,12 @@ auto& solutionLimitArg = solutionLimitFlag.add<Arg<UInt64>>(
     }));
 
 extern bool noPrintSolutions;
-bool noPrintSolutions = false;
 auto& noPrintSolutionsFlag = outputGroup.add<Flag>(
     "--no-print-solutions", Policy::OPTIONAL,
     "Do not print solutions, useful for timing experiements.",
     [](auto&) { noPrintSolutions = true; });
 
 extern bool quietMode;
-bool quietMode = true;
 auto& verboseModeFlag = outputGroup.add<Flag>(
     "--show-progress-stats", Policy::OPTIONAL,
     "print stats information every time an improvement to the objective "
@@ -195,18 +206,37 @@ auto& saveUcbArg =
         .add<Arg<ofstream>>("path_to_file", Policy::MANDATORY,
                             "File to save results to.");
 
+auto& profileFlag = outputGroup.add<ComplexFlag>(
+    "--profile", Policy::OPTIONAL,
+    "Record the number of trigger calls and the time spent in each operator "
+    "and neighbourhood.  Times are in CPU time stamp counter ticks, or "
+    "nanoseconds on platforms without one.  This slows down the search.",
+    [](auto&) { profileTriggers = true; });
+auto& profileArg = profileFlag.add<Arg<string>>(
+    "path_prefix", Policy::MANDATORY,
+    "Write the time of each propagation path to path_prefix.folded, in the "
+    "folded stack format read by flame graph tools, and a summary of each "
+    "operator and neighbourhood to path_prefix.csv.");
+
 enum ImproveStrategyChoice {
     HILL_CLIMBING,
     META_HILL_CLIMBING,
-    LATE_ACCEPTANCE_HILL_CLIMBING
+    LATE_ACCEPTANCE_HILL_CLIMBING,
+    TABU_SEARCH,
+    SIMULATED_ANNEALING
 };
+// the improve strategies that --diversify cycles through
+static const vector<ImproveStrategyChoice> DIVERSIFY_IMPROVE_STRATEGIES = {
+    HILL_CLIMBING, META_HILL_CLIMBING, LATE_ACCEPTANCE_HILL_CLIMBING};
 enum ExploreStrategyChoice {
     VIOLATION_BACKOFF,
     RANDOM_WALK,
     AUTO_EXPLORE,
     NO_EXPLORE,
 };
-enum NhSearchStrategyChoice { APPLY_ONCE, FIRST_AT_LEAST_EQUAL };
+// number of explore strategies, not including NO_EXPLORE
+static const int NUMBER_EXPLORE_STRATEGIES = NO_EXPLORE;
+enum NhSearchStrategyChoice { APPLY_ONCE, FIRST_AT_LEAST_EQUAL, BEST_OF_K };
 enum SelectionStrategyChoice { RANDOM, UCB, INTERACTIVE };
 
 ImproveStrategyChoice improveStrategyChoice = META_HILL_CLIMBING;
@@ -215,8 +245,10 @@ NhSearchStrategyChoice nhSearchStrategyChoice = APPLY_ONCE;
 SelectionStrategyChoice selectionStrategyChoice = UCB;
 
 size_t DEFAULT_LAHC_QUEUE_SIZE = 100;
-UInt64 improveStratPeakIterations = 5000;
-double DEFAULT_UCB_EXPLORATION_BIAS = 1;
+UInt64 DEFAULT_TABU_TENURE = 10;
+UInt64 DEFAULT_ANNEALING_COOLING_ITERATIONS = 100000;
+extern UInt64 improveStratPeakIterations;
+extern double DEFAULT_UCB_EXPLORATION_BIAS;
 bool USE_ITERATIONS_FOR_META_CLIMBER = false;
 
 auto& searchStrategiesGroup = argParser.makePrintGroup(
@@ -254,6 +286,39 @@ auto& queueSizeFlag = lateAcceptanceHillClimbingFlag.add<ComplexFlag>(
 auto& queueSizeArg =
     queueSizeFlag.add<Arg<size_t>>("integer", Policy::MANDATORY, "");
 
+auto& tabuSearchFlag = improveStratGroup.add<ComplexFlag>(
+    "tabu",
+    "Tabu search, a hill climbing strategy that forbids variables from "
+    "returning to recently held values, unless the move improves on the best "
+    "assignment found.  The tenure, the number of iterations a value stays "
+    "forbidden, grows the longer the search fails to improve.",
+    [](auto&&) { improveStrategyChoice = TABU_SEARCH; });
+
+auto& tenureFlag = tabuSearchFlag.add<ComplexFlag>(
+    "--tenure", Policy::OPTIONAL,
+    toString("Set the minimum tenure in iterations (default=",
+             DEFAULT_TABU_TENURE, ").  The tenure grows up to ten times this "
+             "value as the search stalls."));
+
+auto& tenureArg = tenureFlag.add<Arg<UInt64>>("integer", Policy::MANDATORY, "");
+
+auto& simulatedAnnealingFlag = improveStratGroup.add<ComplexFlag>(
+    "annealing",
+    "Simulated annealing, accepts worsening moves with a probability that "
+    "falls as the temperature cools.  The temperatures are calibrated from the "
+    "first moves of the search and the temperature is reheated when the "
+    "search stagnates.",
+    [](auto&&) { improveStrategyChoice = SIMULATED_ANNEALING; });
+
+auto& coolingIterationsFlag = simulatedAnnealingFlag.add<ComplexFlag>(
+    "--cooling-iterations", Policy::OPTIONAL,
+    toString("Set the number of iterations over which the temperature cools "
+             "from the initial to the final temperature (default=",
+             DEFAULT_ANNEALING_COOLING_ITERATIONS, ")."));
+
+auto& coolingIterationsArg =
+    coolingIterationsFlag.add<Arg<UInt64>>("integer", Policy::MANDATORY, "");
+
 auto& peakIterationsFlag = searchStrategiesGroup.add<ComplexFlag>(
     "--improve-peak-iterations", Policy::OPTIONAL,
     toString("Specify how many iterations the selected improve strategy may "
@@ -323,6 +388,24 @@ auto& firstAtLeastEqualIterationsArg =
                           "of the fale strategy.")
         .add<Arg<size_t>>("", Policy::MANDATORY, "");
 
+size_t DEFAULT_BEST_OF_K_SAMPLES = 5;
+auto& bestOfKFlag = nhSearchStratGroup.add<ComplexFlag>(
+    "best-of-k",
+    toString("Sample k moves (default=", DEFAULT_BEST_OF_K_SAMPLES,
+             ") from the neighbourhood, rejecting each, then apply the best "
+             "of them before passing to the improve strategy to decide.  "
+             "Samples are peeked at rather than applied where the "
+             "neighbourhood supports it, only the chosen move counts as an "
+             "iteration."),
+    [](auto&&) { nhSearchStrategyChoice = BEST_OF_K; });
+
+auto& bestOfKSamplesArg =
+    bestOfKFlag
+        .add<ComplexFlag>("--number-samples", Policy::OPTIONAL,
+                          "Specify how many moves to sample for each run of "
+                          "the best-of-k strategy.")
+        .add<Arg<size_t>>("", Policy::MANDATORY, "");
+
 auto& selectionStratGroup =
     searchStrategiesGroup
         .add<ComplexFlag>("--selection", Policy::OPTIONAL,
@@ -358,9 +441,74 @@ auto& disableUcbCostFlag =
 auto& interactiveFlag = selectionStratGroup.add<Flag>(
     "i", "interactive, Prompt user for neighbourhood to select.",
     [](auto&&) { selectionStrategyChoice = INTERACTIVE; });
+
+size_t numberThreads = 1;
+auto& threadsFlag = searchStrategiesGroup.add<ComplexFlag>(
+    "--threads", Policy::OPTIONAL,
+    "Run a portfolio of independent searches in parallel, one per thread.  "
+    "Each thread builds its own copy of the model and searches using the "
+    "random seed plus the thread index.  Only solutions that improve on the "
+    "best found by any thread are printed.  Note, --cpu-time-limit counts the "
+    "CPU time consumed by all threads.");
+auto& threadsArg = threadsFlag.add<Arg<size_t>>(
+    "number_threads", Policy::MANDATORY, "Value greater 0",
+    chain(Converter<size_t>(), [](size_t value) {
+        if (value < 1) {
+            throw ErrorMessage("Value must be greater than 0.");
+        }
+        numberThreads = value;
+        return value;
+    }));
+auto& diversifyFlag = threadsFlag.add<Flag>(
+    "--diversify", Policy::OPTIONAL,
+    "Instead of every thread using the selected improve and explore "
+    "strategies, threads other than the first cycle through the hill "
+    "climbing improve strategies (hc, mhc and lahc) and the explore "
+    "strategies.");
+static const UInt64 DEFAULT_SYNC_INTERVAL = 10000;
+auto& cooperateFlag = threadsFlag.add<ComplexFlag>(
+    "--cooperate", Policy::OPTIONAL,
+    "Share the best valid solution found between threads.  Every sync "
+    "interval iterations, a thread that has not improved on its own best "
+    "since the last sync switches to the best valid solution found by any "
+    "thread, if that solution is better than its own.  Threads that give up "
+    "and restart exploration also switch to the best valid solution.");
+auto& syncIntervalFlag = cooperateFlag.add<ComplexFlag>(
+    "--sync-interval", Policy::OPTIONAL,
+    toString("Number of iterations between sync points (default=",
+             DEFAULT_SYNC_INTERVAL, ")."));
+auto& syncIntervalArg = syncIntervalFlag.add<Arg<UInt64>>(
+    "number_iterations", Policy::MANDATORY, "Value greater 0",
+    chain(Converter<UInt64>(), [](UInt64 value) {
+        if (value < 1) {
+            throw ErrorMessage("Value must be greater than 0.");
+        }
+        return value;
+    }));
+static const UInt64 DEFAULT_EXCHANGE_INTERVAL = 1000;
+auto& temperingFlag = threadsFlag.add<ComplexFlag>(
+    "--tempering", Policy::OPTIONAL,
+    "Parallel tempering.  Instead of the selected improve and explore "
+    "strategies, each thread runs simulated annealing at a fixed temperature, "
+    "the temperatures spaced geometrically between those calibrated by the "
+    "first thread.  Periodically, threads at adjacent temperatures may swap "
+    "temperatures, so that good assignments move towards the colder threads.  "
+    "Requires at least 2 threads.");
+auto& exchangeIntervalFlag = temperingFlag.add<ComplexFlag>(
+    "--exchange-interval", Policy::OPTIONAL,
+    toString("Number of iterations between proposed temperature swaps "
+             "(default=",
+             DEFAULT_EXCHANGE_INTERVAL, ")."));
+auto& exchangeIntervalArg = exchangeIntervalFlag.add<Arg<UInt64>>(
+    "number_iterations", Policy::MANDATORY, "Value greater 0",
+    chain(Converter<UInt64>(), [](UInt64 value) {
+        if (value < 1) {
+            throw ErrorMessage("Value must be greater than 0.");
+        }
+        return value;
+    }));
 auto& devGroup = argParser.makePrintGroup("developer", "Developer options...");
 extern UInt allowedViolation;
-UInt allowedViolation = 0;
 
 auto& allowedViolationArg =
     devGroup
@@ -373,28 +521,73 @@ auto& allowedViolationArg =
                             return value;
                         }));
 
+auto& batchTriggersFlag = devGroup.add<Flag>(
+    "--batch-triggers", Policy::OPTIONAL,
+    "Still in development, during a move collect the subsequence changes of "
+    "quantifiers and sequence literals and forward them to their parents once "
+    "per merged range, rather than once per changed member.",
+    [](auto&) { batchTriggerPropagation = true; });
+
+auto& peekMovesFlag = devGroup.add<Flag>(
+    "--peek-moves", Policy::OPTIONAL,
+    "Still in development, compute the violation and objective of int and "
+    "bool assignment moves without applying them, only applying accepted "
+    "moves.  Moves reaching operators that do not support this are applied "
+    "and undone as normal.",
+    [](auto&) { peekMoves = true; });
+
 auto& disableVioBiasFlag = devGroup.add<Flag>(
     "--disable-vio-bias", Policy::OPTIONAL,
     "Disable the search from biasing towards violating variables.");
 
 extern bool allowForwardingOfDefiningExprs;
-bool allowForwardingOfDefiningExprs = true;
 auto& disableDefinedExprsFlag =
     devGroup.add<Flag>("--disable-defined-vars", Policy::OPTIONAL,
                        "Disable the forwarding of values from expressions to "
                        "the variables that they define through equality.  "
                        "This does not include top level equalities.",
                        [](auto&) { allowForwardingOfDefiningExprs = false; });
-extern bool useShaHashing;
-bool useShaHashing = false;
+extern HashFunction hashFunction;
 auto& useStrongHashingFlag = devGroup.add<Flag>(
     "--use-strong-hashing", Policy::OPTIONAL,
     "Use a slower but stronger hashing algorithm (currently SHA256).  This has "
-    "a varying effect on performance depending on problem complexity.",
-    [](auto&) { useShaHashing = true; });
+    "a varying effect on performance depending on problem complexity.  Same "
+    "as --hash-function sha256.",
+    [](auto&) { hashFunction = HashFunction::SHA256; });
+
+auto& hashFunctionGroup =
+    devGroup
+        .add<ComplexFlag>("--hash-function", Policy::OPTIONAL,
+                          "Specify the function used to hash values "
+                          "(default=word-mix).")
+        .makeExclusiveGroup(Policy::MANDATORY);
+auto& wordMixFlag = hashFunctionGroup.add<Flag>(
+    "word-mix",
+    "Mix a word at a time with the splitmix64 finaliser, the fastest.",
+    [](auto&&) { hashFunction = HashFunction::WORD_MIX; });
+auto& murmur3Flag = hashFunctionGroup.add<Flag>(
+    "murmur3", "MurmurHash3, truncated to 64 bits.",
+    [](auto&&) { hashFunction = HashFunction::MURMUR3; });
+auto& sha256Flag = hashFunctionGroup.add<Flag>(
+    "sha256", "SHA256, truncated to 64 bits, the slowest but strongest.",
+    [](auto&&) { hashFunction = HashFunction::SHA256; });
+
+extern RandomGeneratorType randomGeneratorType;
+auto& randomGeneratorGroup =
+    devGroup
+        .add<ComplexFlag>("--random-generator", Policy::OPTIONAL,
+                          "Specify the algorithm of the random generator "
+                          "(default=xoshiro256).  Each algorithm gives a "
+                          "different search for the same --random-seed.")
+        .makeExclusiveGroup(Policy::MANDATORY);
+auto& xoshiroFlag = randomGeneratorGroup.add<Flag>(
+    "xoshiro256", "xoshiro256**, the fastest.",
+    [](auto&&) { randomGeneratorType = RandomGeneratorType::XOSHIRO256; });
+auto& pcgFlag = randomGeneratorGroup.add<Flag>(
+    "pcg64", "PCG64 (XSL RR 128/64).",
+    [](auto&&) { randomGeneratorType = RandomGeneratorType::PCG64; });
 
 extern bool shouldRunHashChecks;
-bool shouldRunHashChecks = false;
 auto& shouldRunHashChecksFlag =
     devGroup.add<Flag>("--debug-run-hash-checks", Policy::OPTIONAL,
                        "Still in development, verify no hash collisions before "
@@ -405,8 +598,8 @@ void setTimeout(int numberSeconds, bool virtualTimer);
 void sigIntHandler(int);
 void sigAlarmHandler(int);
 
-bool runSanityChecks = false;
-bool verboseSanityError = false;
+extern bool runSanityChecks;
+extern bool verboseSanityError;
 auto& sanityCheckFlag = devGroup.add<ComplexFlag>(
     "--sanity-check", Policy::OPTIONAL,
     "Activate sanity check mode, this is a debugging feature,.  After each "
@@ -417,13 +610,13 @@ auto& sanityCheckFlag = devGroup.add<ComplexFlag>(
 auto& verboseErrorFlag = sanityCheckFlag.add<Flag>(
     "--verbose", Policy::OPTIONAL, "Verbose printing at point of error.",
     [](auto&) { verboseSanityError = true; });
-bool repeatSanityCheckOfConst = false;
+extern bool repeatSanityCheckOfConst;
 auto& repeatSanityCheckFlag = sanityCheckFlag.add<Flag>(
     "--repeat-check-of-const", Policy::OPTIONAL,
     "repeat the checks of expressions that are constant.",
     [](auto&) { repeatSanityCheckOfConst = true; });
 
-bool dontSkipSanityCheckForAlreadyVisitedChildren = false;
+extern bool dontSkipSanityCheckForAlreadyVisitedChildren;
 auto& dontSkipSanityCheckFlag = sanityCheckFlag.add<Flag>(
     "--dont-skip-repeat-visits", Policy::OPTIONAL,
     "When a child has multiple parents, the child will be visited multiple "
@@ -432,7 +625,6 @@ auto& dontSkipSanityCheckFlag = sanityCheckFlag.add<Flag>(
     [](auto&) { dontSkipSanityCheckForAlreadyVisitedChildren = true; });
 
 extern UInt64 sanityCheckInterval;
-UInt64 sanityCheckInterval = 1;
 auto& sanityCheckIntervalArg =
     sanityCheckFlag
         .add<ComplexFlag>("--at-intervals-of", Policy::OPTIONAL,
@@ -444,8 +636,7 @@ auto& sanityCheckIntervalArg =
                               return value;
                           }));
 
-debug_code(bool debugLogAllowed = true;
-           auto& disableDebugLoggingFlag = devGroup.add<Flag>(
+debug_code(auto& disableDebugLoggingFlag = devGroup.add<Flag>(
                "--disable-debug-log", Policy::OPTIONAL,
                "Included only for debug builds, can be used to silence "
                "logging "
@@ -453,7 +644,8 @@ debug_code(bool debugLogAllowed = true;
                [](auto&) { debugLogAllowed = false; }););
 
 std::shared_ptr<SearchStrategy> makeExploreStrategy(
-    std::shared_ptr<SearchStrategy> improve) {
+    std::shared_ptr<SearchStrategy> improve,
+    ExploreStrategyChoice exploreStrategyChoice) {
     switch (exploreStrategyChoice) {
         case VIOLATION_BACKOFF:
             return make_shared<ExplorationUsingViolationBackOff>(improve);
@@ -470,7 +662,8 @@ std::shared_ptr<SearchStrategy> makeExploreStrategy(
 
 std::shared_ptr<SearchStrategy> makeImproveStrategy(
     std::shared_ptr<NeighbourhoodSelectionStrategy> selector,
-    std::shared_ptr<NeighbourhoodSearchStrategy> searcher) {
+    std::shared_ptr<NeighbourhoodSearchStrategy> searcher,
+    ImproveStrategyChoice improveStrategyChoice) {
     switch (improveStrategyChoice) {
         case HILL_CLIMBING:
             return make_shared<HillClimbing>(selector, searcher);
@@ -484,6 +677,17 @@ std::shared_ptr<SearchStrategy> makeImproveStrategy(
             return make_shared<LateAcceptanceHillClimbing>(selector, searcher,
                                                            queueSize);
         }
+        case TABU_SEARCH: {
+            UInt64 tenure = (tenureArg) ? tenureArg.get() : DEFAULT_TABU_TENURE;
+            return make_shared<TabuSearch>(selector, searcher, tenure);
+        }
+        case SIMULATED_ANNEALING: {
+            UInt64 coolingIterations =
+                (coolingIterationsArg) ? coolingIterationsArg.get()
+                                       : DEFAULT_ANNEALING_COOLING_ITERATIONS;
+            return make_shared<SimulatedAnnealing>(selector, searcher,
+                                                   coolingIterations);
+        }
         default:
             myAbort();
     }
@@ -499,6 +703,11 @@ std::shared_ptr<NeighbourhoodSearchStrategy> makeNeighbourhoodSearchStrategy() {
                                     : DEFAULT_FIRST_AT_LEAST_EQUAL_ITERATIONS;
             return make_shared<FirstAtLeastEqual>(iterations);
         }
+        case BEST_OF_K: {
+            size_t samples = (bestOfKSamplesArg) ? bestOfKSamplesArg.get()
+                                                 : DEFAULT_BEST_OF_K_SAMPLES;
+            return make_shared<BestOfK>(samples);
+        }
         default:
             myAbort();
     }
@@ -555,7 +764,8 @@ void setSignalsAndHandlers() {
     }
 }
 
-void printFinalStats(const State& state) {
+void printFinalStats(const State& state, UInt64 numberTriggerEvents,
+                     const RecycleStats& unrollRecycleStats) {
     if (showNhStatsFlag) {
         if (showNhStatsArg) {
             state.stats.printNeighbourhoodStats(showNhStatsArg.get());
@@ -564,14 +774,44 @@ void printFinalStats(const State& state) {
         }
     }
     cout << "\n\n";
-    cout << state.stats << "\nTrigger event count " << triggerEventCount
+    cout << state.stats << "\nTrigger event count " << numberTriggerEvents
          << "\n";
+    cout << "Unroll recycle hits: " << unrollRecycleStats.hits
+         << ", misses: " << unrollRecycleStats.misses << endl;
 
     auto times = state.stats.getTime();
     cout << "total real time actually spent in neighbourhoods: "
          << state.totalTimeInNeighbourhoods << endl;
+    if (numberTriggerEvents > 0) {
+        cout << "Real time in neighbourhoods per trigger event (ns): "
+             << (state.totalTimeInNeighbourhoods * 1e9) / numberTriggerEvents
+             << endl;
+    }
     cout << "Total CPU time: " << times.first << endl;
     cout << "Total real time: " << times.second << endl;
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        // ru_maxrss is in kilobytes on linux
+        cout << "Peak resident memory (KB): " << usage.ru_maxrss << endl;
+    }
+}
+
+void writeProfile(const TriggerProfiler& profiler) {
+    if (!profileFlag) {
+        return;
+    }
+    string foldedPath = profileArg.get() + ".folded";
+    string summaryPath = profileArg.get() + ".csv";
+    ofstream folded(foldedPath), summary(summaryPath);
+    if (!folded || !summary) {
+        myCerr << "Error: could not write profile to " << foldedPath
+               << " and " << summaryPath << endl;
+        return;
+    }
+    profiler.printFoldedStacks(folded);
+    profiler.printSummary(summary);
+    cout << "Profile written to " << foldedPath << " and " << summaryPath
+         << endl;
 }
 
 string findConjure() {
@@ -656,20 +896,44 @@ static vector<nlohmann::json> getInputs() {
     chrono::high_resolution_clock::time_point startTime =
         chrono::high_resolution_clock::now();
     string jsonConjureFlag;
-    if (endsWith(specArg.get(), ".essence") ||
-        endsWith(paramArg.get(), ".param")) {
+    // with a model cache, conjure is only looked for on a cache miss
+    if (!modelCacheFlag && (endsWith(specArg.get(), ".essence") ||
+                            endsWith(paramArg.get(), ".param"))) {
         conjurePath = findConjure();
         jsonConjureFlag = findCorrectJsonFlagForConjure(conjurePath);
     }
+    lib::optional<ModelCache> modelCache;
+    if (modelCacheFlag) {
+        modelCache.emplace(modelCacheArg.get());
+    }
+    auto readInput = [&](const string& file, bool useConjure, bool specFile) {
+        if (!useConjure || !modelCache) {
+            return parseJson(file, useConjure, conjurePath, jsonConjureFlag,
+                             specFile);
+        }
+        string key = modelCache->key(file, specFile);
+        auto cachedJson = modelCache->load(key);
+        if (cachedJson) {
+            cout << "Using cached translation of "
+                 << ((specFile) ? "essence" : "param") << " file\n";
+            return std::move(*cachedJson);
+        }
+        if (conjurePath.empty()) {
+            conjurePath = findConjure();
+            jsonConjureFlag = findCorrectJsonFlagForConjure(conjurePath);
+        }
+        auto json = parseJson(file, true, conjurePath, jsonConjureFlag,
+                              specFile);
+        modelCache->save(key, json);
+        return json;
+    };
     vector<nlohmann::json> jsons;
-    jsons.emplace_back(parseJson(specArg.get(),
-                                 endsWith(specArg.get(), ".essence"),
-                                 conjurePath, jsonConjureFlag, true));
+    jsons.emplace_back(readInput(specArg.get(),
+                                 endsWith(specArg.get(), ".essence"), true));
     if (paramArg) {
-        jsons.insert(
-            jsons.begin(),
-            parseJson(paramArg.get(), endsWith(paramArg.get(), ".param"),
-                      conjurePath, jsonConjureFlag, false));
+        jsons.insert(jsons.begin(),
+                     readInput(paramArg.get(),
+                               endsWith(paramArg.get(), ".param"), false));
     }
     chrono::high_resolution_clock::time_point endTime =
         chrono::high_resolution_clock::now();
@@ -678,6 +942,149 @@ static vector<nlohmann::json> getInputs() {
     return jsons;
 }
 
+struct PortfolioWorker {
+    unsigned int seed;
+    std::unique_ptr<State> state;
+    std::shared_ptr<NeighbourhoodSelectionStrategy> nhSelection;
+    std::shared_ptr<SearchStrategy> improve;
+    std::shared_ptr<SearchStrategy> explore;
+    UInt64 numberTriggerEvents = 0;
+    RecycleStats recycleStats;
+    TriggerProfiler profile;
+    std::exception_ptr error;
+};
+
+static void runPortfolioWorker(size_t workerId, PortfolioWorker& worker) {
+    portfolioWorkerId = workerId;
+    globalRandomGenerator.seed(worker.seed);
+    try {
+        search(worker.explore, *worker.state);
+    } catch (...) {
+        // stop the other workers, error is rethrown on the main thread
+        worker.error = std::current_exception();
+        activePortfolio->markFinished();
+    }
+    worker.numberTriggerEvents = triggerEventCount;
+    worker.recycleStats = recycleStats;
+    worker.profile = std::move(triggerProfiler);
+}
+
+static void runPortfolio(vector<nlohmann::json>& jsons, unsigned int seed) {
+    vector<PortfolioWorker> workers(numberThreads);
+    unique_ptr<ReplicaExchange> replicaExchange;
+    if (temperingFlag) {
+        replicaExchange = make_unique<ReplicaExchange>(
+            workers.size(), (exchangeIntervalFlag) ? exchangeIntervalArg.get()
+                                                   : DEFAULT_EXCHANGE_INTERVAL);
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        auto& worker = workers[i];
+        ParsedModel parsedModel = parseModelFromJson(jsons);
+        worker.state = make_unique<State>(parsedModel.builder->build());
+        worker.state->disableVarViolations = disableVioBiasFlag;
+        worker.seed = seed + i;
+        ImproveStrategyChoice improveChoice = improveStrategyChoice;
+        ExploreStrategyChoice exploreChoice = exploreStrategyChoice;
+        if (diversifyFlag && i > 0) {
+            auto& rotation = DIVERSIFY_IMPROVE_STRATEGIES;
+            // the selected strategy may not be part of the rotation
+            size_t position =
+                find(rotation.begin(), rotation.end(), improveChoice) -
+                rotation.begin();
+            improveChoice = rotation[(position + i) % rotation.size()];
+            exploreChoice = static_cast<ExploreStrategyChoice>(
+                (exploreChoice + i / rotation.size()) %
+                NUMBER_EXPLORE_STRATEGIES);
+        }
+        worker.nhSelection = makeNeighbourhoodSelectionStrategy(*worker.state);
+        if (replicaExchange) {
+            worker.improve = make_shared<SimulatedAnnealing>(
+                worker.nhSelection, makeNeighbourhoodSearchStrategy(),
+                DEFAULT_ANNEALING_COOLING_ITERATIONS, replicaExchange.get(), i);
+            worker.explore = worker.improve;
+            continue;
+        }
+        worker.improve = makeImproveStrategy(
+            worker.nhSelection, makeNeighbourhoodSearchStrategy(),
+            improveChoice);
+        worker.explore = makeExploreStrategy(worker.improve, exploreChoice);
+    }
+    cout << "Using seed: " << seed << endl;
+    cout << "Running portfolio of " << workers.size() << " threads\n";
+    if (replicaExchange) {
+        cout << "Parallel tempering, proposing temperature swaps every "
+             << replicaExchange->exchangeInterval << " iterations\n";
+    }
+    UInt64 syncInterval = 0;
+    if (cooperateFlag) {
+        syncInterval =
+            (syncIntervalFlag) ? syncIntervalArg.get() : DEFAULT_SYNC_INTERVAL;
+        cout << "Sharing solutions between threads every " << syncInterval
+             << " iterations\n";
+    }
+    Portfolio portfolio(workers.size(), syncInterval);
+    activePortfolio = &portfolio;
+    setSignalsAndHandlers();
+    vector<thread> threads;
+    for (size_t i = 0; i < workers.size(); i++) {
+        threads.emplace_back(runPortfolioWorker, i, std::ref(workers[i]));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    activePortfolio = nullptr;
+    for (auto& worker : workers) {
+        if (worker.error) {
+            rethrow_exception(worker.error);
+        }
+    }
+
+    auto& best = workers[portfolio.getBestWorker()];
+    if (saveBestSolution) {
+        bestSolutionFileArg.get() << bestSolution;
+    }
+    if (selectionStrategyChoice == UCB) {
+        saveUcbResults(*best.state,
+                       static_pointer_cast<UcbNeighbourhoodSelector>(
+                           best.nhSelection));
+    }
+    cout << "\n\nPortfolio workers:\n";
+    csvRow(cout, "worker", "seed", "bestViolation", "bestObjective",
+           "numberIterations", "triggerEvents", "imports", "importsImproved");
+    for (size_t i = 0; i < workers.size(); i++) {
+        auto& stats = workers[i].state->stats;
+        csvRow(cout, i, workers[i].seed, stats.bestViolation,
+               ((stats.bestObjective.isDefined())
+                    ? toString(stats.bestObjective)
+                    : "undefined"),
+               stats.numberIterations, workers[i].numberTriggerEvents,
+               portfolio.getSharingStats(i).numberImports,
+               portfolio.getSharingStats(i).numberImportsImproved);
+    }
+    if (replicaExchange) {
+        cout << "\nReplicas:\n";
+        csvRow(cout, "replica", "temperature", "worseningAcceptanceRate",
+               "swapsProposed", "swapsAccepted");
+        for (size_t i = 0; i < workers.size(); i++) {
+            auto& annealing =
+                static_cast<SimulatedAnnealing&>(*workers[i].improve);
+            auto& stats = replicaExchange->getStats(i);
+            csvRow(cout, i,
+                   ((replicaExchange->ladderReady())
+                        ? toString(replicaExchange->getTemperature(i))
+                        : "uncalibrated"),
+                   annealing.worseningAcceptanceRate(),
+                   stats.numberSwapsProposed, stats.numberSwapsAccepted);
+        }
+    }
+    cout << "Best solution found by worker " << portfolio.getBestWorker()
+         << endl;
+    best.explore->printAdditionalStats(cout);
+    best.improve->printAdditionalStats(cout);
+    printFinalStats(*best.state, best.numberTriggerEvents, best.recycleStats);
+    writeProfile(best.profile);
+}
+
 int main(const int argc, const char** argv) {
     cout << "ATHANOR\n";
 
@@ -699,13 +1106,23 @@ int main(const int argc, const char** argv) {
                << endl;
         myExit(1);
     }
+    if (temperingFlag && numberThreads < 2) {
+        myCerr << "Error: --tempering requires at least 2 threads, a single "
+                  "thread can not exchange temperatures.  Use --improve "
+                  "annealing instead.\n";
+        myExit(1);
+    }
 
     try {
         // parse files
         vector<nlohmann::json> jsons = getInputs();
+        unsigned int seed = (seedArg) ? seedArg.get() : random_device()();
+        if (numberThreads > 1) {
+            runPortfolio(jsons, seed);
+            return 0;
+        }
         ParsedModel parsedModel = parseModelFromJson(jsons);
         State state(parsedModel.builder->build());
-        unsigned int seed = (seedArg) ? seedArg.get() : random_device()();
         globalRandomGenerator.seed(seed);
         cout << "Using seed: " << seed << endl;
         state.disableVarViolations = disableVioBiasFlag;
@@ -713,8 +1130,9 @@ int main(const int argc, const char** argv) {
 
         auto nhSelection = makeNeighbourhoodSelectionStrategy(state);
         auto nhSearch = makeNeighbourhoodSearchStrategy();
-        auto improve = makeImproveStrategy(nhSelection, nhSearch);
-        auto explore = makeExploreStrategy(improve);
+        auto improve =
+            makeImproveStrategy(nhSelection, nhSearch, improveStrategyChoice);
+        auto explore = makeExploreStrategy(improve, exploreStrategyChoice);
         search(explore, state);
         if (saveBestSolution) {
             bestSolutionFileArg.get() << bestSolution;
@@ -725,7 +1143,8 @@ int main(const int argc, const char** argv) {
         }
         explore->printAdditionalStats(cout);
         improve->printAdditionalStats(cout);
-        printFinalStats(state);
+        printFinalStats(state, triggerEventCount, recycleStats);
+        writeProfile(triggerProfiler);
     } catch (nlohmann::detail::exception& e) {
         myCerr << "Error parsing JSON: " << e.what() << endl;
         myExit(1);
@@ -766,7 +1185,7 @@ void setTimeout(int numberSeconds, bool virtualTimer) {
     }
 }
 
-volatile bool sigIntActivated = false, sigAlarmActivated = false;
+extern std::atomic<bool> sigIntActivated, sigAlarmActivated;
 static const int DELAYED_FORCED_EXIT_TIME = 10;
 void forceExit() {
     cout << "\n\nFORCE EXIT\n";
@@ -815,11 +1234,12 @@ void runSolverWasm(string specJsonString, string paramJsonString) {
 
     auto nhSelection = makeNeighbourhoodSelectionStrategy(state);
     auto nhSearch = makeNeighbourhoodSearchStrategy();
-    auto improve = makeImproveStrategy(nhSelection, nhSearch);
-    auto explore = makeExploreStrategy(improve);
+    auto improve =
+        makeImproveStrategy(nhSelection, nhSearch, improveStrategyChoice);
+    auto explore = makeExploreStrategy(improve, exploreStrategyChoice);
     search(explore, state);
 
-    printFinalStats(state);
+    printFinalStats(state, triggerEventCount, recycleStats);
 }
 
 std::ostringstream myCerr;
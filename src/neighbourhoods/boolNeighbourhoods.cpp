@@ -28,19 +28,18 @@ void boolAssignRandomNeighbourhoodImpl(const BoolDomain& domain,
     debug_neighbourhood_action("Assigning random value: original value is "
                                << asView(val));
     bool success;
+    UInt newViolation;
     do {
-        success = val.changeValue([&]() {
-            val.violation = getRandomValueInDomain(domain);
-            ++params.stats.minorNodeCount;
-            if (params.parentCheck(params.vals)) {
-                return true;
-            } else {
-                val.violation = backup;
-                return false;
-            }
-        });
+        newViolation = getRandomValueInDomain(domain);
+        ++params.stats.minorNodeCount;
+        val.violation = newViolation;
+        // as in changeValue, the parent check is made before an unchanged
+        // value is rejected, so that the search is the same as when moves
+        // were applied through changeValue
+        success = params.parentCheck(params.vals) && newViolation != backup;
+        val.violation = backup;
         if (success) {
-            debug_neighbourhood_action("New value is " << asView(val));
+            debug_neighbourhood_action("New value is " << (newViolation == 0));
         }
     } while (!success && ++numberTries < tryLimit);
     if (!success) {
@@ -48,12 +47,26 @@ void boolAssignRandomNeighbourhoodImpl(const BoolDomain& domain,
             "Couldn't find value, number tries=" << tryLimit);
         return;
     }
-    if (!params.changeAccepted()) {
-        debug_neighbourhood_action("Change rejected");
+    auto assign = [&](UInt violation) {
         val.changeValue([&]() {
-            val.violation = backup;
+            val.violation = violation;
             return true;
         });
+    };
+    auto accepted = peekAndAskStrategy(val, params, [&]() {
+        return val.peekViolationAndNotify(newViolation);
+    });
+    if (!accepted) {
+        assign(newViolation);
+        accepted = params.changeAccepted();
+        if (!*accepted) {
+            assign(backup);
+        }
+    } else if (*accepted) {
+        assign(newViolation);
+    }
+    if (!*accepted) {
+        debug_neighbourhood_action("Change rejected");
     }
 }
 
@@ -98,27 +98,25 @@ struct IntAssignRandom {
         UInt varViolation = params.vioContainer.varViolation(val.id);
         bool success;
         size_t selectedOption;
+        Int newValue;
         do {
             ++params.stats.minorNodeCount;
-            success = val.changeValue([&]() {
-                if (varViolation == 0 || selector.next() == 0) {
-                    selectedOption = 0;
-                    val.value = getRandomValueInDomain(domain);
-                } else {
-                    selectedOption = 1;
-                    val.value =
-                        getRandomValueInDomain(domain, val.value - varViolation,
-                                               val.value + varViolation);
-                }
-                if (params.parentCheck(params.vals)) {
-                    return true;
-                } else {
-                    val.value = backup;
-                    return false;
-                }
-            });
+            if (varViolation == 0 || selector.next() == 0) {
+                selectedOption = 0;
+                val.value = getRandomValueInDomain(domain);
+            } else {
+                selectedOption = 1;
+                val.value = getRandomValueInDomain(
+                    domain, val.value - varViolation, val.value + varViolation);
+            }
+            newValue = val.value;
+            // as in changeValue, the parent check is made before an unchanged
+            // value is rejected, so that the search is the same as when moves
+            // were applied through changeValue
+            success = params.parentCheck(params.vals) && newValue != backup;
+            val.value = backup;
             if (success) {
-                debug_neighbourhood_action("New value is " << asView(val));
+                debug_neighbourhood_action("New value is " << newValue);
             } else {
                 selector.reportResult(selectedOption, 0, 1);
             }
@@ -128,16 +126,28 @@ struct IntAssignRandom {
                 "Couldn't find value, number tries=" << tryLimit);
             return;
         }
-
-        if (params.changeAccepted()) {
+        auto assign = [&](Int value) {
+            val.changeValue([&]() {
+                val.value = value;
+                return true;
+            });
+        };
+        auto accepted = peekAndAskStrategy(
+            val, params, [&]() { return val.peekValueAndNotify(newValue); });
+        if (!accepted) {
+            assign(newValue);
+            accepted = params.changeAccepted();
+            if (!*accepted) {
+                assign(backup);
+            }
+        } else if (*accepted) {
+            assign(newValue);
+        }
+        if (*accepted) {
             selector.reportResult(selectedOption, 1, 1);
         } else {
             selector.reportResult(selectedOption, 0, 1);
             debug_neighbourhood_action("Change rejected");
-            val.changeValue([&]() {
-                val.value = backup;
-                return true;
-            });
         }
     }
 };
@@ -5,6 +5,7 @@
 
 #include "search/statsContainer.h"
 using namespace std;
+bool peekMoves = false;
 UInt64 NeighbourhoodResourceTracker::remainingResource() {
     return resourceLimit - resourceConsumed;
 }
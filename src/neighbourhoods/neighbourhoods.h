@@ -24,6 +24,10 @@ struct NeighbourhoodParams {
     ViolationContainer& vioContainer;
     std::vector<ViolationContainer*>
         vioContainers;  // only for neighbourhoods who require multiple vars
+    // the move is only being sampled and will be rejected, see
+    // State::sampleNeighbourhood.  It is peeked at whenever possible, even
+    // without --peek-moves.
+    bool sampling = false;
 
     NeighbourhoodParams(const AcceptanceCallBack& changeAccepted,
                         const ParentCheckCallBack& parentCheck,
@@ -42,6 +46,27 @@ struct NeighbourhoodParams {
     }
 };
 
+extern bool peekMoves;
+/* Speculative evaluation of a change to a top level variable (--peek-moves),
+ * see base/peek.h.  peekChange() should pass the change to the triggers of the
+ * variable without applying it.  If every trigger reached could peek, returns
+ * whether the strategy accepted the change, the change is not applied.
+ * Otherwise returns nothing and the caller should apply the change and undo it
+ * if rejected as usual. */
+template <typename PeekFunc>
+lib::optional<bool> peekAndAskStrategy(const ValBase& val,
+                                       NeighbourhoodParams& params,
+                                       PeekFunc&& peekChange) {
+    if ((!peekMoves && !params.sampling) || val.container != &variablePool) {
+        return lib::nullopt;
+    }
+    PeekScope peekScope;
+    if (!peekChange()) {
+        return lib::nullopt;
+    }
+    return params.changeAccepted();
+}
+
 /* a neighbourhood: which is basically a name and a function that can be
  * invokved with neighbourhood parameters */
 struct Neighbourhood {
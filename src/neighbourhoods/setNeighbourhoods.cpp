@@ -216,11 +216,21 @@ struct SetMove : public NeighbourhoodFunc<SetDomain, 2, SetMove<InnerDomain>> {
                              calcNumberInsertionAttempts(toVal.numberElements(),
                                                          innerDomainSize);
         debug_neighbourhood_action("Looking for value to move");
+        // members of top level vars are drawn by violation
+        const ViolationContainer* fromVioContainer = nullptr;
+        if (!params.vioContainers.empty()) {
+            const ViolationContainer& vioContainer =
+                *params.vioContainers.front();
+            fromVioContainer = &vioContainer.childViolations(fromVal.id);
+        }
         bool success = false;
         do {
             ++params.stats.minorNodeCount;
             UInt indexToMove =
-                globalRandom<UInt>(0, fromVal.numberElements() - 1);
+                (fromVioContainer)
+                    ? fromVioContainer->selectRandomVar(
+                          fromVal.numberElements() - 1)
+                    : globalRandom<UInt>(0, fromVal.numberElements() - 1);
             if (toVal.containsMember(
                     fromVal.getMembers<InnerViewType>()[indexToMove])) {
                 continue;
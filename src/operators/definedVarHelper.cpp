@@ -14,9 +14,10 @@
 #include "types/tupleVal.h"
 using namespace std;
 
-UInt64 DefinesLock::globalStamp = 1;
-deque<AnyDefinedVarTrigger> definedVarTriggerQueue;
-deque<AnyDefinedVarTrigger> delayedDefinedVarTriggerQueue;
+thread_local UInt64 DefinesLock::globalStamp = 1;
+thread_local deque<AnyDefinedVarTrigger> definedVarTriggerQueue;
+thread_local deque<AnyDefinedVarTrigger> delayedDefinedVarTriggerQueue;
+thread_local vector<UInt> forwardedVarIds;
 
 typename deque<AnyDefinedVarTrigger>::iterator findNextTrigger(
     deque<AnyDefinedVarTrigger>& queue);
@@ -83,6 +84,16 @@ bool isInContainerSupportingDefinedVars(ValBase* container) {
            isInContainerSupportingDefinedVars(container->container);
 }
 
+void recordForwardedVar(const ValBase& val) {
+    const ValBase* var = &val;
+    while (var->container && !isPoolMarker(var->container)) {
+        var = var->container;
+    }
+    if (var->container == &variablePool) {
+        forwardedVarIds.emplace_back(var->id);
+    }
+}
+
 void updateParentContainer(ValBase* container, UInt childId) {
     if (!container || isPoolMarker(container)) {
         return;
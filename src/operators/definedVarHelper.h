@@ -6,7 +6,7 @@
 // values to variables that are defined off them.
 extern bool allowForwardingOfDefiningExprs;
 class DefinesLock {
-    static UInt64 globalStamp;
+    static thread_local UInt64 globalStamp;
     UInt64 localStamp = std::numeric_limits<UInt64>().max();
 
    public:
@@ -50,4 +50,9 @@ class DefinesLock {
 template <typename Op>
 struct DefinedVarTrigger;
 void handleDefinedVarTriggers();
+// ids of the variables of the model whose values have been changed by
+// forwarding the value of the expression defining them (or defining one of
+// their members), with repeats.  Cleared by the search before each move, see
+// State::runNeighbourhood.
+extern thread_local std::vector<UInt> forwardedVarIds;
 #endif /* SRC_OPERATORS_definedVARHELPER_H_ */
@@ -7,6 +7,8 @@
 void handleDefinedVarTriggers();
 bool isInContainerSupportingDefinedVars(ValBase* container);
 void updateParentContainer(ValBase* container, UInt memberId);
+// add the variable of the model that val is or belongs to to forwardedVarIds
+void recordForwardedVar(const ValBase& val);
 
 enum class DefinedDirection { NONE, LEFT, RIGHT, BOTH };
 
@@ -99,6 +101,7 @@ struct DefinedVarTrigger {
             toOption->matchValueOf(*fromOption);
             auto& val = static_cast<Value&>(*toOption);
             updateParentContainer(val.container, val.id);
+            recordForwardedVar(val);
             // must call updateValue to the operator as if the value was already
             // matched, the op might not know this and may not have updated
             op->updateValue(*leftOption, *rightOption);
@@ -110,8 +113,9 @@ typedef lib::variant<DefinedVarTrigger<OpIntEq>, DefinedVarTrigger<OpBoolEq>,
                      DefinedVarTrigger<OpEnumEq>>
     AnyDefinedVarTrigger;
 
-extern std::deque<AnyDefinedVarTrigger> definedVarTriggerQueue;
-extern std::deque<AnyDefinedVarTrigger> delayedDefinedVarTriggerQueue;
+extern thread_local std::deque<AnyDefinedVarTrigger> definedVarTriggerQueue;
+extern thread_local std::deque<AnyDefinedVarTrigger>
+    delayedDefinedVarTriggerQueue;
 
 template <typename Op>
 DefinedVarTrigger<Op>* addDefinedVarTrigger(Op* op,
@@ -37,7 +37,7 @@ struct OpMaker<EnumRange> {
 };
 
 ExprRef<SequenceView> OpMaker<EnumRange>::make(shared_ptr<EnumDomain> d) {
-    return make_shared<EnumRange>(move(d));
+    return makeShared<EnumRange>(move(d));
 }
 
 string EnumRange::getOpName() const {
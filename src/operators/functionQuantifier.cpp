@@ -125,7 +125,7 @@ struct ContainerTrigger<FunctionView> : public FunctionTrigger {
     }
     void reattachTrigger() final {
         deleteTrigger(op->containerTrigger);
-        auto trigger = make_shared<ContainerTrigger<FunctionView>>(op);
+        auto trigger = makeShared<ContainerTrigger<FunctionView>>(op);
         op->container->addTrigger(trigger);
         op->containerTrigger = trigger;
     }
@@ -134,13 +134,13 @@ void OperatorTrates<IntRange>::Trigger<isLeft>::reattachTrigger() {
 }
 template <bool isLeft>
 void OperatorTrates<IntRange>::Trigger<isLeft>::reassignLeftTrigger() {
-    auto newTrigger = make_shared<Trigger<true>>(op);
+    auto newTrigger = makeShared<Trigger<true>>(op);
     op->left->addTrigger(newTrigger);
     op->leftTrigger = newTrigger;
 }
 template <bool isLeft>
 void OperatorTrates<IntRange>::Trigger<isLeft>::reassignRightTrigger() {
-    auto newTrigger = make_shared<Trigger<false>>(op);
+    auto newTrigger = makeShared<Trigger<false>>(op);
     op->right->addTrigger(newTrigger);
     op->rightTrigger = newTrigger;
 }
@@ -173,7 +173,7 @@ struct OpMaker<IntRange> {
 
 ExprRef<SequenceView> OpMaker<IntRange>::make(ExprRef<IntView> l,
                                               ExprRef<IntView> r) {
-    return make_shared<IntRange>(move(l), move(r));
+    return makeShared<IntRange>(move(l), move(r));
 }
 
 string IntRange::getOpName() const {
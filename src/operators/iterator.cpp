@@ -39,7 +39,7 @@ struct Iterator<View>::RefTrigger
     void reattachTrigger() {
         deleteTrigger(this->op->refTrigger);
         auto trigger =
-            make_shared<typename Iterator<View>::RefTrigger>(this->op);
+            makeShared<typename Iterator<View>::RefTrigger>(this->op);
         this->op->ref->addTrigger(trigger);
         this->op->refTrigger = trigger;
     }
@@ -57,7 +57,7 @@ void Iterator<View>::reattachRefTrigger() {
     if (refTrigger) {
         deleteTrigger(refTrigger);
     }
-    refTrigger = make_shared<RefTrigger>(this);
+    refTrigger = makeShared<RefTrigger>(this);
     debug_code(assert(ref));
     ref->addTrigger(refTrigger);
 }
@@ -66,7 +66,7 @@ template <typename View>
 void Iterator<View>::startTriggeringImpl() {
     debug_code(assert(ref));
     if (!refTrigger) {
-        refTrigger = make_shared<RefTrigger>(this);
+        refTrigger = makeShared<RefTrigger>(this);
         ref->addTrigger(refTrigger);
     }
     // unlike other operators, always forward startTriggering.
@@ -61,7 +61,7 @@ struct ContainerTrigger<MSetView> : public MSetTrigger {
     }
     void reattachTrigger() final {
         deleteTrigger(op->containerTrigger);
-        auto trigger = make_shared<ContainerTrigger<MSetView>>(op);
+        auto trigger = makeShared<ContainerTrigger<MSetView>>(op);
         op->container->addTrigger(trigger);
         op->containerTrigger = trigger;
     }
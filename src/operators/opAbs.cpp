@@ -14,7 +14,7 @@ void OpAbs::updateVarViolationsImpl(const ViolationContext& vioContext,
         dynamic_cast<const IntViolationContext*>(&vioContext);
     if (intVioContextTest) {
         this->operand->updateVarViolations(
-            IntViolationContext(intVioContextTest->parentViolation,
+            IntViolationContext(*intVioContextTest,
                                 (intVioContextTest->reason == TOO_LARGE)
                                     ? TOO_SMALL
                                     : TOO_LARGE),
@@ -52,5 +52,5 @@ struct OpMaker<OpAbs> {
 };
 
 ExprRef<IntView> OpMaker<OpAbs>::make(ExprRef<IntView> o) {
-    return make_shared<OpAbs>(move(o));
+    return makeShared<OpAbs>(move(o));
 }
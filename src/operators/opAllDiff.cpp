@@ -6,6 +6,7 @@
 
 #include "operators/shiftViolatingIndices.h"
 #include "operators/simpleOperator.hpp"
+#include "types/int.h"
 #include "utils/ignoreUnused.h"
 using namespace std;
 using OperandsSequenceTrigger =
@@ -154,6 +155,42 @@ class OperatorTrates<OpAllDiff>::OperandsSequenceTrigger
         debug_code(op->assertValidState());
     }
 
+    // only int members are peeked, the hypothetical hash of each member and
+    // the hypothetical number of members with each hash are kept as slots.
+    bool peekMemberChanged(UInt index) final {
+        auto members = lib::get_if<ExprRefVec<IntView>>(
+            &op->operand->view()->members);
+        if (!op->allOperandsAreDefined() || !members) {
+            return false;
+        }
+        auto memberView = (*members)[index]->getViewIfDefined();
+        if (!memberView) {
+            return false;
+        }
+        HashType newHash = getIntValueHash(peekValue(*memberView));
+        HashType oldHash = peekContext.exchangeHashSlot(
+            &op->indicesHashMap, index, op->indicesHashMap[index], newHash);
+        if (oldHash == newHash) {
+            return true;
+        }
+        auto peekCountChange = [&](HashType hash, Int change) {
+            auto iter = op->hashIndicesMap.find(hash);
+            Int count =
+                (iter == op->hashIndicesMap.end()) ? 0 : iter->second.size();
+            count = peekContext.slot(&op->hashIndicesMap, hash, count) + change;
+            peekContext.setSlot(&op->hashIndicesMap, hash, count);
+            return count;
+        };
+        Int violation = peekViolation(*op);
+        if (peekCountChange(oldHash, -1) >= 1) {
+            --violation;
+        }
+        if (peekCountChange(newHash, 1) > 1) {
+            ++violation;
+        }
+        return op->peekViolationAndNotify(violation);
+    }
+
     void valueChanged() final {
         op->changeValue([&]() {
             op->reevaluate();
@@ -162,7 +199,7 @@ class OperatorTrates<OpAllDiff>::OperandsSequenceTrigger
     }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<OperandsSequenceTrigger>(op);
+        auto trigger = makeShared<OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -396,5 +433,5 @@ struct OpMaker<OpAllDiff> {
 };
 
 ExprRef<BoolView> OpMaker<OpAllDiff>::make(ExprRef<SequenceView> o) {
-    return make_shared<OpAllDiff>(move(o));
+    return makeShared<OpAllDiff>(move(o));
 }
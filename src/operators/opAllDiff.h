@@ -7,6 +7,7 @@
 #include "types/bool.h"
 #include "types/sequence.h"
 #include "utils/fastIterableIntSet.h"
+#include "utils/hashIndexMap.h"
 struct OpAllDiff;
 template <>
 struct OperatorTrates<OpAllDiff> {
@@ -22,7 +23,7 @@ struct OpAllDiff
 
     using SimpleUnaryOperator<BoolView, SequenceView,
                               OpAllDiff>::SimpleUnaryOperator;
-    HashMap<HashType, FastIterableIntSet> hashIndicesMap;
+    HashIndexMap<FastIterableIntSet> hashIndicesMap;
     std::vector<HashType> indicesHashMap;
     FastIterableIntSet violatingOperands;
 
@@ -49,5 +49,5 @@ struct OpMaker<OpAmplifyConstraint> {
 
 ExprRef<BoolView> OpMaker<OpAmplifyConstraint>::make(ExprRef<BoolView> o,
                                                      UInt64 multiplier) {
-    return make_shared<OpAmplifyConstraint>(move(o), multiplier);
+    return makeShared<OpAmplifyConstraint>(move(o), multiplier);
 }
@@ -10,21 +10,22 @@
 #include "types/boolVal.h"
 #include "types/sequenceVal.h"
 #include "utils/ignoreUnused.h"
+#include "utils/simdKernels.h"
 using namespace std;
 using OperandsSequenceTrigger = OperatorTrates<OpAnd>::OperandsSequenceTrigger;
 
 void OpAnd::reevaluateImpl(SequenceView& operandView) {
-    violation = 0;
-    cachedViolations.clear();
-    for (size_t i = 0; i < operandView.numberElements(); ++i) {
-        auto& operandChild = operand->view()->getMembers<BoolView>()[i];
-        UInt operandViolation = operandChild->view()->violation;
-        cachedViolations.insert(i, operandViolation);
+    auto& members = operandView.getMembers<BoolView>();
+    auto& violations = cachedViolations.contents;
+    violations.resize(members.size());
+    for (size_t i = 0; i < members.size(); ++i) {
+        UInt operandViolation = members[i]->view()->violation;
+        violations[i] = operandViolation;
         if (operandViolation > 0) {
             violatingOperands.insert(i);
         }
-        violation += operandViolation;
     }
+    violation = simd::sum(violations.data(), violations.size());
 }
 
 void OpAnd::updateVarViolationsImpl(const ViolationContext& vioContext,
@@ -105,7 +106,7 @@ ExprRef<BoolView> OpMaker<OpAnd>::make(
         val->setConstant(true);
         return val.asExpr();
     }
-    return make_shared<OpAnd>(move(o));
+    return makeShared<OpAnd>(move(o));
 }
 
 template struct SimpleUnaryOperator<BoolView, SequenceView, OpAnd>;
@@ -9,6 +9,7 @@
 #include "types/bool.h"
 #include "types/sequence.h"
 #include "utils/fastIterableIntSet.h"
+#include "utils/simdKernels.h"
 
 struct OpAnd;
 template <>
@@ -101,24 +102,40 @@ class OperatorTrates<OpAnd>::OperandsSequenceTrigger : public SequenceTrigger {
     }
 
     void subsequenceChanged(UInt startIndex, UInt endIndex) final {
-        UInt violationToAdd = 0, violationToRemove = 0;
+        const UInt* violations = op->cachedViolations.contents.data();
+        UInt violationToRemove =
+            simd::sum(violations + startIndex, endIndex - startIndex);
         for (size_t i = startIndex; i < endIndex; i++) {
             UInt newViolation = getViolation(i);
             UInt oldViolation = op->cachedViolations.getAndSet(i, newViolation);
-            violationToAdd += newViolation;
-            violationToRemove += oldViolation;
             if (oldViolation > 0 && newViolation == 0) {
                 op->violatingOperands.erase(i);
             } else if (oldViolation == 0 && newViolation > 0) {
                 op->violatingOperands.insert(i);
             }
         }
+        UInt violationToAdd =
+            simd::sum(violations + startIndex, endIndex - startIndex);
         op->changeValue([&]() {
             op->violation -= violationToRemove;
             op->violation += violationToAdd;
             return true;
         });
     }
+    bool peekMemberChanged(UInt index) final {
+        auto operandView = op->operand->getViewIfDefined();
+        if (!operandView) {
+            return false;
+        }
+        auto& members = operandView->getMembers<BoolView>();
+        UInt newViolation = peekViolation(*members[index]->view());
+        UInt oldViolation =
+            peekContext.exchangeSlot(&op->cachedViolations, index,
+                                     op->cachedViolations.get(index),
+                                     newViolation);
+        return op->peekViolationAndNotify(peekViolation(*op) - oldViolation +
+                                          newViolation);
+    }
     void valueChanged() final {
         op->changeValue([&]() {
             op->reevaluate(true, true);
@@ -127,7 +144,7 @@ class OperatorTrates<OpAnd>::OperandsSequenceTrigger : public SequenceTrigger {
     }
 
     void reattachTrigger() final {
-        auto trigger = std::make_shared<OperandsSequenceTrigger>(op);
+        auto trigger = makeShared<OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
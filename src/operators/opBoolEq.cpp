@@ -106,5 +106,5 @@ struct OpMaker<OpBoolEq> {
 
 ExprRef<BoolView> OpMaker<OpBoolEq>::make(ExprRef<BoolView> l,
                                           ExprRef<BoolView> r) {
-    return make_shared<OpBoolEq>(move(l), move(r));
+    return makeShared<OpBoolEq>(move(l), move(r));
 }
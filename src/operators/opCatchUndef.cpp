@@ -85,7 +85,7 @@ struct OpCatchUndef<ExprViewType>::ExprTrigger
     void reattachTrigger() final {
         deleteTrigger(this->op->exprTrigger);
         auto trigger =
-            make_shared<OpCatchUndef<ExprViewType>::ExprTrigger>(this->op);
+            makeShared<OpCatchUndef<ExprViewType>::ExprTrigger>(this->op);
         this->op->expr->addTrigger(trigger);
         this->op->exprTrigger = trigger;
     }
@@ -95,7 +95,7 @@ template <typename ExprViewType>
 void OpCatchUndef<ExprViewType>::startTriggeringImpl() {
     if (!exprTrigger) {
         exprTrigger =
-            make_shared<typename OpCatchUndef<ExprViewType>::ExprTrigger>(this);
+            makeShared<typename OpCatchUndef<ExprViewType>::ExprTrigger>(this);
         expr->addTrigger(exprTrigger);
         expr->startTriggering();
     }
@@ -128,7 +128,7 @@ void OpCatchUndef<ExprViewType>::updateVarViolationsImpl(
 template <typename ExprViewType>
 ExprRef<ExprViewType> OpCatchUndef<ExprViewType>::deepCopyForUnrollImpl(
     const ExprRef<ExprViewType>&, const AnyIterRef& iterator) const {
-    auto newOpCatchUndef = make_shared<OpCatchUndef<ExprViewType>>(
+    auto newOpCatchUndef = makeShared<OpCatchUndef<ExprViewType>>(
         expr->deepCopyForUnroll(expr, iterator), replacement);
     return newOpCatchUndef;
 }
@@ -153,7 +153,7 @@ template <typename ExprViewType>
 pair<bool, ExprRef<ExprViewType>> OpCatchUndef<ExprViewType>::optimiseImpl(
     ExprRef<ExprViewType>&, PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpCatchUndef<ExprViewType>>(expr, replacement);
+    auto newOp = makeShared<OpCatchUndef<ExprViewType>>(expr, replacement);
     AnyExprRef newOpAsExpr((ExprRef<ExprViewType>(newOp)));
     optimised |= optimise(newOpAsExpr, newOp->expr, path);
     optimised |= optimise(newOpAsExpr, newOp->replacement, path);
@@ -186,7 +186,7 @@ struct OpMaker<OpCatchUndef<View>> {
 template <typename View>
 ExprRef<View> OpMaker<OpCatchUndef<View>>::make(ExprRef<View> expr,
                                                 ExprRef<View> replacement) {
-    return make_shared<OpCatchUndef<View>>(move(expr), move(replacement));
+    return makeShared<OpCatchUndef<View>>(move(expr), move(replacement));
 }
 
 #define opCatchUndefInstantiators(name)       \
@@ -73,5 +73,5 @@ struct OpMaker<OpDiv> {
 };
 
 ExprRef<IntView> OpMaker<OpDiv>::make(ExprRef<IntView> l, ExprRef<IntView> r) {
-    return make_shared<OpDiv>(move(l), move(r));
+    return makeShared<OpDiv>(move(l), move(r));
 }
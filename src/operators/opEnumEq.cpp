@@ -79,5 +79,5 @@ struct OpMaker<OpEnumEq> {
 
 ExprRef<BoolView> OpMaker<OpEnumEq>::make(ExprRef<EnumView> l,
                                           ExprRef<EnumView> r) {
-    return make_shared<OpEnumEq>(move(l), move(r));
+    return makeShared<OpEnumEq>(move(l), move(r));
 }
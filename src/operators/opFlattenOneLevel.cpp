@@ -124,7 +124,7 @@ struct OpFlattenOneLevel<SequenceInnerType>::InnerSequenceTrigger
     void hasBecomeDefined() {}
     void reattachTrigger() {
         deleteTrigger(op->innerSequenceTriggers[index]);
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OpFlattenOneLevel<SequenceInnerType>::InnerSequenceTrigger>(op,
                                                                         index);
         op->operand->view()
@@ -191,7 +191,7 @@ struct OpFlattenOneLevel<SequenceInnerType>::OperandTrigger
     }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<OperandTrigger>(op);
+        auto trigger = makeShared<OperandTrigger>(op);
         deleteTrigger(op->operandTrigger);
         this->op->operand->addTrigger(trigger);
         op->reattachAllInnerSequenceTriggers(true);
@@ -224,7 +224,7 @@ struct OpFlattenOneLevel<SequenceInnerType>::OperandTrigger
         }
         op->innerSequenceTriggers.insert(
             op->innerSequenceTriggers.begin() + index,
-            make_shared<
+            makeShared<
                 OpFlattenOneLevel<SequenceInnerType>::InnerSequenceTrigger>(
                 op, index));
         sequence->addTrigger(op->innerSequenceTriggers[index]);
@@ -381,7 +381,7 @@ void OpFlattenOneLevel<SequenceInnerType>::reattachAllInnerSequenceTriggers(
                                .getMembers<SequenceView>();
     for (UInt i = 0; i < innerSequences.size(); i++) {
         innerSequenceTriggers.emplace_back(
-            make_shared<InnerSequenceTrigger>(this, i));
+            makeShared<InnerSequenceTrigger>(this, i));
         innerSequences[i]->addTrigger(innerSequenceTriggers.back());
     }
 }
@@ -389,7 +389,7 @@ void OpFlattenOneLevel<SequenceInnerType>::reattachAllInnerSequenceTriggers(
 template <typename SequenceInnerType>
 void OpFlattenOneLevel<SequenceInnerType>::startTriggeringImpl() {
     if (!operandTrigger) {
-        operandTrigger = std::make_shared<OperandTrigger>(this);
+        operandTrigger = makeShared<OperandTrigger>(this);
         operand->addTrigger(operandTrigger);
         reattachAllInnerSequenceTriggers(false);
         operand->startTriggering();
@@ -430,7 +430,7 @@ template <typename SequenceInnerType>
 ExprRef<SequenceView>
 OpFlattenOneLevel<SequenceInnerType>::deepCopyForUnrollImpl(
     const ExprRef<SequenceView>&, const AnyIterRef& iterator) const {
-    auto newOp = make_shared<OpFlattenOneLevel<SequenceInnerType>>(
+    auto newOp = makeShared<OpFlattenOneLevel<SequenceInnerType>>(
         operand->deepCopyForUnroll(operand, iterator));
     return newOp;
 }
@@ -445,7 +445,7 @@ template <typename SequenceInnerType>
 std::pair<bool, ExprRef<SequenceView>>
 OpFlattenOneLevel<SequenceInnerType>::optimiseImpl(ExprRef<SequenceView>&,
                                                    PathExtension path) {
-    auto newOp = make_shared<OpFlattenOneLevel>(operand);
+    auto newOp = makeShared<OpFlattenOneLevel>(operand);
     bool optimised = false;
     optimised |= optimise(ExprRef<SequenceView>(newOp), newOp->operand, path);
     return make_pair(optimised, newOp);
@@ -510,7 +510,7 @@ struct OpMaker<OpFlattenOneLevel<SequenceInnerType>> {
 template <typename SequenceInnerType>
 ExprRef<SequenceView> OpMaker<OpFlattenOneLevel<SequenceInnerType>>::make(
     ExprRef<SequenceView> o) {
-    return make_shared<OpFlattenOneLevel<SequenceInnerType>>(move(o));
+    return makeShared<OpFlattenOneLevel<SequenceInnerType>>(move(o));
 }
 
 #define opFlattenOneLevelInstantiators(name)       \
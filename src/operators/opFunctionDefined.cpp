@@ -72,7 +72,7 @@ struct OperatorTrates<OpFunctionDefined>::OperandTrigger
     }
     void reattachTrigger() {
         auto trigger =
-            make_shared<OperatorTrates<OpFunctionDefined>::OperandTrigger>(op);
+            makeShared<OperatorTrates<OpFunctionDefined>::OperandTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -131,5 +131,5 @@ struct OpMaker<OpFunctionDefined> {
 };
 
 ExprRef<SetView> OpMaker<OpFunctionDefined>::make(ExprRef<FunctionView> o) {
-    return make_shared<OpFunctionDefined>(move(o));
+    return makeShared<OpFunctionDefined>(move(o));
 }
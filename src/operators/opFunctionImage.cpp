@@ -276,7 +276,7 @@ struct OpFunctionImage<FunctionMemberViewType>::FunctionOperandTrigger
         if (op->memberTrigger) {
             deleteTrigger(op->memberTrigger);
         }
-        auto trigger = make_shared<FunctionOperandTrigger>(op);
+        auto trigger = makeShared<FunctionOperandTrigger>(op);
         op->functionOperand->addTrigger(trigger, false);
         if (op->locallyDefined) {
             op->reattachFunctionMemberTrigger();
@@ -313,7 +313,7 @@ struct PreImageTrigger
                       PreImageTrigger<FunctionMemberViewType, TriggerType>>(
             op->preImageTrigger));
         auto trigger =
-            make_shared<PreImageTrigger<FunctionMemberViewType, TriggerType>>(
+            makeShared<PreImageTrigger<FunctionMemberViewType, TriggerType>>(
                 op);
         lib::get<ExprRef<PreImageType>>(op->preImageOperand)
             ->addTrigger(trigger);
@@ -342,7 +342,7 @@ struct OpFunctionImage<FunctionMemberViewType>::MemberTrigger
     }
     void reattachTrigger() final {
         deleteTrigger(this->op->memberTrigger);
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             typename OpFunctionImage<FunctionMemberViewType>::MemberTrigger>(
             this->op);
         this->op->getMember().get()->addTrigger(trigger);
@@ -360,14 +360,14 @@ void OpFunctionImage<FunctionMemberViewType>::startTriggeringImpl() {
             [&](auto& preImageOperand) {
                 typedef typename AssociatedTriggerType<viewType(
                     preImageOperand)>::type TriggerType;
-                auto trigger = make_shared<
+                auto trigger = makeShared<
                     PreImageTrigger<FunctionMemberViewType, TriggerType>>(this);
                 preImageTrigger = trigger;
                 preImageOperand->addTrigger(trigger);
                 preImageOperand->startTriggering();
             },
             preImageOperand);
-        functionOperandTrigger = make_shared<
+        functionOperandTrigger = makeShared<
             OpFunctionImage<FunctionMemberViewType>::FunctionOperandTrigger>(
             this);
         functionOperand->addTrigger(functionOperandTrigger, false);
@@ -386,9 +386,9 @@ void OpFunctionImage<FunctionMemberViewType>::reattachFunctionMemberTrigger() {
     if (memberTrigger) {
         deleteTrigger(memberTrigger);
     }
-    functionMemberTrigger = make_shared<FunctionOperandTrigger>(this);
+    functionMemberTrigger = makeShared<FunctionOperandTrigger>(this);
     memberTrigger =
-        make_shared<OpFunctionImage<FunctionMemberViewType>::MemberTrigger>(
+        makeShared<OpFunctionImage<FunctionMemberViewType>::MemberTrigger>(
             this);
     functionOperand->addTrigger(functionMemberTrigger, true, cachedIndex);
     auto member = getMember();
@@ -451,7 +451,7 @@ ExprRef<FunctionMemberViewType>
 OpFunctionImage<FunctionMemberViewType>::deepCopyForUnrollImpl(
     const ExprRef<FunctionMemberViewType>&, const AnyIterRef& iterator) const {
     auto newOpFunctionImage =
-        make_shared<OpFunctionImage<FunctionMemberViewType>>(
+        makeShared<OpFunctionImage<FunctionMemberViewType>>(
             functionOperand->deepCopyForUnroll(functionOperand, iterator),
             invoke_r(preImageOperand,
                      deepCopyForUnroll(preImageOperand, iterator), AnyExprRef));
@@ -488,7 +488,7 @@ pair<bool, ExprRef<FunctionMemberViewType>>
 OpFunctionImage<FunctionMemberViewType>::optimiseImpl(
     ExprRef<FunctionMemberViewType>&, PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpFunctionImage<FunctionMemberViewType>>(
+    auto newOp = makeShared<OpFunctionImage<FunctionMemberViewType>>(
         functionOperand, preImageOperand);
     AnyExprRef newOpAsExpr = ExprRef<FunctionMemberViewType>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->functionOperand, path);
@@ -546,7 +546,7 @@ struct OpMaker<OpFunctionImage<View>> {
 template <typename View>
 ExprRef<View> OpMaker<OpFunctionImage<View>>::make(
     ExprRef<FunctionView> function, AnyExprRef preImage) {
-    return make_shared<OpFunctionImage<View>>(move(function), move(preImage));
+    return makeShared<OpFunctionImage<View>>(move(function), move(preImage));
 }
 
 #define opFunctionImageInstantiators(name)       \
@@ -44,7 +44,7 @@ struct ExprTrigger
     void reattachTrigger() final {
         deleteTrigger(static_pointer_cast<ExprTrigger<TriggerType>>(
             op->exprTriggers[index]));
-        auto trigger = make_shared<ExprTrigger<TriggerType>>(op, index);
+        auto trigger = makeShared<ExprTrigger<TriggerType>>(op, index);
         op->getRange<typename AssociatedViewType<TriggerType>::type>()[index]
             ->addTrigger(trigger);
         op->exprTriggers[index] = trigger;
@@ -68,7 +68,7 @@ void OpFunctionLitBasic::startTriggeringImpl() {
                     TriggerType;
                 for (size_t i = 0; i < members.size(); i++) {
                     auto trigger =
-                        make_shared<ExprTrigger<TriggerType>>(this, i);
+                        makeShared<ExprTrigger<TriggerType>>(this, i);
                     members[i]->addTrigger(trigger);
                     exprTriggers.emplace_back(move(trigger));
                     members[i]->startTriggering();
@@ -130,7 +130,7 @@ ExprRef<FunctionView> OpFunctionLitBasic::deepCopyForUnrollImpl(
         },
         range);
 
-    auto newOpFunctionLitBasic = make_shared<OpFunctionLitBasic>();
+    auto newOpFunctionLitBasic = makeShared<OpFunctionLitBasic>();
     newOpFunctionLitBasic->initView(preimageDomain,
                                     makeDimensionVecFromDomain(preimageDomain),
                                     move(newMembers), false);
@@ -171,7 +171,7 @@ void OpFunctionLitBasic::findAndReplaceSelf(const FindAndReplaceFunction& func,
 
 pair<bool, ExprRef<FunctionView>> OpFunctionLitBasic::optimiseImpl(
     ExprRef<FunctionView>&, PathExtension path) {
-    auto newOp = make_shared<OpFunctionLitBasic>();
+    auto newOp = makeShared<OpFunctionLitBasic>();
     newOp->initView(preimageDomain, preimages, range, partial);
     AnyExprRef newOpAsExpr = ExprRef<FunctionView>(newOp);
     bool optimised = false;
@@ -219,7 +219,7 @@ struct OpMaker<OpFunctionLitBasic> {
 template <typename RangeViewType>
 EnableIfViewAndReturn<RangeViewType, ExprRef<FunctionView>>
 OpMaker<OpFunctionLitBasic>::make(AnyDomainRef) {
-    auto op = make_shared<OpFunctionLitBasic>();
+    auto op = makeShared<OpFunctionLitBasic>();
     return op;
 }
 
@@ -79,7 +79,7 @@ struct OperatorTrates<OpFunctionPreimage<OperandView>>::LeftTrigger
     void adapterHasBecomeUndefined() { todoImpl(); }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OperatorTrates<OpFunctionPreimage<OperandView>>::LeftTrigger>(op);
         op->left->addTrigger(trigger);
         op->leftTrigger = trigger;
@@ -214,7 +214,7 @@ struct OperatorTrates<OpFunctionPreimage<OperandView>>::RightTrigger
     void hasBecomeDefined() { todoImpl(); }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OperatorTrates<OpFunctionPreimage<OperandView>>::RightTrigger>(op);
         op->right->addTrigger(trigger);
         op->rightTrigger = trigger;
@@ -301,7 +301,7 @@ struct OpMaker<OpFunctionPreimage<OperandView>> {
 template <typename OperandView>
 ExprRef<SetView> OpMaker<OpFunctionPreimage<OperandView>>::make(
     ExprRef<OperandView> l, ExprRef<FunctionView> r) {
-    return make_shared<OpFunctionPreimage<OperandView>>(move(l), move(r));
+    return makeShared<OpFunctionPreimage<OperandView>>(move(l), move(r));
 }
 
 #define opMakerInstantiator(name)                                            \
@@ -60,5 +60,5 @@ struct OpMaker<OpImplies> {
 
 ExprRef<BoolView> OpMaker<OpImplies>::make(ExprRef<BoolView> l,
                                            ExprRef<BoolView> r) {
-    return make_shared<OpImplies>(move(l), move(r));
+    return makeShared<OpImplies>(move(l), move(r));
 }
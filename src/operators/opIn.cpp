@@ -73,7 +73,7 @@ struct ExprTrigger
     void reattachTrigger() {
         deleteTrigger(this->op->exprTrigger);
         auto& expr = lib::get<ExprRef<ExprType>>(this->op->expr);
-        auto trigger = make_shared<ExprTrigger<ExprTriggerType>>(
+        auto trigger = makeShared<ExprTrigger<ExprTriggerType>>(
             this->op, getTriggeringOperand());
         expr->addTrigger(trigger);
         this->op->exprTrigger = trigger;
@@ -87,7 +87,7 @@ struct OpIn::SetOperandTrigger : public Trigger<SetOperandTrigger, SetTrigger> {
     void reattachTrigger() final {
         deleteTrigger(this->op->setOperandTrigger);
         auto trigger =
-            make_shared<SetOperandTrigger>(this->op, getTriggeringOperand());
+            makeShared<SetOperandTrigger>(this->op, getTriggeringOperand());
         this->op->setOperand->addTrigger(trigger);
         this->op->setOperandTrigger = trigger;
     }
@@ -100,13 +100,13 @@ void OpIn::startTriggeringImpl() {
                 typedef typename AssociatedTriggerType<viewType(expr)>::type
                     TriggerType;
                 auto trigger =
-                    make_shared<ExprTrigger<TriggerType>>(this, expr);
+                    makeShared<ExprTrigger<TriggerType>>(this, expr);
                 exprTrigger = trigger;
                 expr->addTrigger(trigger);
                 expr->startTriggering();
             },
             expr);
-        setOperandTrigger = make_shared<SetOperandTrigger>(this, setOperand);
+        setOperandTrigger = makeShared<SetOperandTrigger>(this, setOperand);
         setOperand->addTrigger(setOperandTrigger);
         setOperand->startTriggering();
     }
@@ -141,7 +141,7 @@ void OpIn::updateVarViolationsImpl(const ViolationContext&,
 
 ExprRef<BoolView> OpIn::deepCopyForUnrollImpl(
     const ExprRef<BoolView>&, const AnyIterRef& iterator) const {
-    auto newOpIn = make_shared<OpIn>(
+    auto newOpIn = makeShared<OpIn>(
         invoke_r(expr, expr->deepCopyForUnroll(expr, iterator), AnyExprRef),
         setOperand->deepCopyForUnroll(setOperand, iterator));
     return newOpIn;
@@ -164,7 +164,7 @@ void OpIn::findAndReplaceSelf(const FindAndReplaceFunction& func,
 
 pair<bool, ExprRef<BoolView>> OpIn::optimiseImpl(ExprRef<BoolView>&,
                                                  PathExtension path) {
-    auto newOp = make_shared<OpIn>(expr, setOperand);
+    auto newOp = makeShared<OpIn>(expr, setOperand);
     AnyExprRef newOpAsExpr = ExprRef<BoolView>(newOp);
     bool optimised = false;
     lib::visit(
@@ -206,5 +206,5 @@ struct OpMaker<OpIn> {
 
 ExprRef<BoolView> OpMaker<OpIn>::make(AnyExprRef expr,
                                       ExprRef<SetView> setOperand) {
-    return make_shared<OpIn>(move(expr), move(setOperand));
+    return makeShared<OpIn>(move(expr), move(setOperand));
 }
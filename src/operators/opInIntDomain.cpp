@@ -132,7 +132,7 @@ struct OpMaker<OpInDomain<IntView>> {
 
 ExprRef<BoolView> OpMaker<OpInDomain<IntView>>::make(
     shared_ptr<IntDomain> domain, ExprRef<IntView> o) {
-    auto op = make_shared<OpInDomain<IntView>>(move(o));
+    auto op = makeShared<OpInDomain<IntView>>(move(o));
     op->domain = move(domain);
     return op;
 }
@@ -102,5 +102,5 @@ struct OpMaker<OpIntEq> {
 
 ExprRef<BoolView> OpMaker<OpIntEq>::make(ExprRef<IntView> l,
                                          ExprRef<IntView> r) {
-    return make_shared<OpIntEq>(move(l), move(r));
+    return makeShared<OpIntEq>(move(l), move(r));
 }
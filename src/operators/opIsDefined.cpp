@@ -50,7 +50,7 @@ struct OpMaker<OpIsDefined<View>> {
 };
 template <typename View>
 ExprRef<BoolView> OpMaker<OpIsDefined<View>>::make(ExprRef<View> o) {
-    return make_shared<OpIsDefined<View>>(move(o));
+    return makeShared<OpIsDefined<View>>(move(o));
 }
 
 #define opIsDefinedInstantiators(name)       \
@@ -19,6 +19,8 @@ struct OpIsDefined
                               OpIsDefined<View>>::SimpleUnaryOperator;
 
     void reevaluateImpl(View& view);
+    // operators only peek at changes that leave them defined
+    inline bool peekChange() { return true; }
     void updateVarViolationsImpl(const ViolationContext& vioContext,
                                  ViolationContainer& vioContainer) final;
     void copy(OpIsDefined& newOp) const;
@@ -7,6 +7,14 @@ void OpLess::reevaluateImpl(IntView& leftView, IntView& rightView, bool, bool) {
     violation = abs(min<Int>(diff, 0));
 }
 
+bool OpLess::peekChange() {
+    if (!allOperandsAreDefined()) {
+        return false;
+    }
+    Int diff = (peekValue(*right->view()) - 1) - peekValue(*left->view());
+    return peekViolationAndNotify(abs(min<Int>(diff, 0)));
+}
+
 void OpLess::updateVarViolationsImpl(const ViolationContext&,
                                      ViolationContainer& vioContainer) {
     if (violation == 0) {
@@ -63,5 +71,5 @@ struct OpMaker<OpLess> {
 
 ExprRef<BoolView> OpMaker<OpLess>::make(ExprRef<IntView> l,
                                         ExprRef<IntView> r) {
-    return make_shared<OpLess>(move(l), move(r));
+    return makeShared<OpLess>(move(l), move(r));
 }
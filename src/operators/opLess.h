@@ -18,6 +18,7 @@ struct OpLess
                                OpLess>::SimpleBinaryOperator;
 
     void reevaluateImpl(IntView& leftView, IntView& rightView, bool, bool);
+    bool peekChange();
     void updateVarViolationsImpl(const ViolationContext& vioContext,
                                  ViolationContainer& vioContainer) final;
     void copy(OpLess& newOp) const;
@@ -8,6 +8,14 @@ void OpLessEq::reevaluateImpl(IntView& leftView, IntView& rightView, bool,
     violation = abs(min<Int>(diff, 0));
 }
 
+bool OpLessEq::peekChange() {
+    if (!allOperandsAreDefined()) {
+        return false;
+    }
+    Int diff = peekValue(*right->view()) - peekValue(*left->view());
+    return peekViolationAndNotify(abs(min<Int>(diff, 0)));
+}
+
 void OpLessEq::updateVarViolationsImpl(const ViolationContext&,
                                        ViolationContainer& vioContainer) {
     if (violation == 0) {
@@ -64,5 +72,5 @@ struct OpMaker<OpLessEq> {
 
 ExprRef<BoolView> OpMaker<OpLessEq>::make(ExprRef<IntView> l,
                                           ExprRef<IntView> r) {
-    return make_shared<OpLessEq>(move(l), move(r));
+    return makeShared<OpLessEq>(move(l), move(r));
 }
@@ -47,7 +47,7 @@ struct ExprTrigger
     void reattachTrigger() final {
         deleteTrigger(static_pointer_cast<ExprTrigger<TriggerType>>(
             op->exprTriggers[index]));
-        auto trigger = make_shared<ExprTrigger<TriggerType>>(op, index);
+        auto trigger = makeShared<ExprTrigger<TriggerType>>(op, index);
         op->getMembers<typename AssociatedViewType<TriggerType>::type>()[index]
             ->addTrigger(trigger);
         op->exprTriggers[index] = trigger;
@@ -72,7 +72,7 @@ void OpMSetLit::startTriggeringImpl() {
                     TriggerType;
                 for (size_t i = 0; i < members.size(); i++) {
                     auto trigger =
-                        make_shared<ExprTrigger<TriggerType>>(this, i);
+                        makeShared<ExprTrigger<TriggerType>>(this, i);
                     members[i]->addTrigger(trigger);
                     exprTriggers.emplace_back(move(trigger));
                     members[i]->startTriggering();
@@ -134,7 +134,7 @@ ExprRef<MSetView> OpMSetLit::deepCopyForUnrollImpl(
         },
         members);
 
-    auto newOpMSetLit = make_shared<OpMSetLit>(move(newMembers));
+    auto newOpMSetLit = makeShared<OpMSetLit>(move(newMembers));
     return newOpMSetLit;
 }
 
@@ -170,7 +170,7 @@ void OpMSetLit::findAndReplaceSelf(const FindAndReplaceFunction& func,
 
 pair<bool, ExprRef<MSetView>> OpMSetLit::optimiseImpl(ExprRef<MSetView>&,
                                                       PathExtension path) {
-    auto newOp = make_shared<OpMSetLit>(members);
+    auto newOp = makeShared<OpMSetLit>(members);
     AnyExprRef newOpAsExpr = ExprRef<MSetView>(newOp);
     bool optimised = false;
     lib::visit(
@@ -200,5 +200,5 @@ struct OpMaker<OpMSetLit> {
 };
 
 ExprRef<MSetView> OpMaker<OpMSetLit>::make(AnyExprVec o) {
-    return make_shared<OpMSetLit>(move(o));
+    return makeShared<OpMSetLit>(move(o));
 }
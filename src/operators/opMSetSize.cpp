@@ -44,5 +44,5 @@ struct OpMaker<OpMSetSize> {
 };
 
 ExprRef<IntView> OpMaker<OpMSetSize>::make(ExprRef<MSetView> o) {
-    return make_shared<OpMSetSize>(move(o));
+    return makeShared<OpMSetSize>(move(o));
 }
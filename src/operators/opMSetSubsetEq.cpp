@@ -118,7 +118,7 @@ struct OperatorTrates<OpMsetSubsetEq>::LeftTrigger : public MSetTrigger {
 
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpMsetSubsetEq>::LeftTrigger>(op);
+            makeShared<OperatorTrates<OpMsetSubsetEq>::LeftTrigger>(op);
         op->left->addTrigger(trigger);
         op->leftTrigger = trigger;
     }
@@ -182,7 +182,7 @@ struct OperatorTrates<OpMsetSubsetEq>::RightTrigger : public MSetTrigger {
 
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpMsetSubsetEq>::RightTrigger>(op);
+            makeShared<OperatorTrates<OpMsetSubsetEq>::RightTrigger>(op);
         op->right->addTrigger(trigger);
         op->rightTrigger = trigger;
     }
@@ -238,5 +238,5 @@ struct OpMaker<OpMsetSubsetEq> {
 
 ExprRef<BoolView> OpMaker<OpMsetSubsetEq>::make(ExprRef<MSetView> l,
                                                 ExprRef<MSetView> r) {
-    return make_shared<OpMsetSubsetEq>(move(l), move(r));
+    return makeShared<OpMsetSubsetEq>(move(l), move(r));
 }
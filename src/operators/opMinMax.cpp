@@ -16,13 +16,48 @@ using OperandsSequenceTrigger =
     typename OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger;
 
 template <bool minMode>
-void updateMinValues(OpMinMax<minMode>& op, bool trigger);
+void updateMinValues(OpMinMax<minMode>& op, bool trigger,
+                     bool refreshOperandValues = true);
 
 template <bool minMode>
 bool OpMinMax<minMode>::compare(Int u, Int v) {
     return (minMode) ? u < v : v < u;
 }
 
+template <bool minMode>
+inline Int getOperandValue(const ExprRef<IntView>& operandChild) {
+    auto operandChildView = operandChild->getViewIfDefined();
+    return (operandChildView) ? operandChildView->value
+                              : MinMaxSegmentTree<minMode>::identity();
+}
+
+template <bool minMode>
+void refreshOperandValues(OpMinMax<minMode>& op) {
+    auto operandView = op.operand->view();
+    if (!operandView) {
+        op.operandValues.clear();
+        op.operandValuesValid = false;
+        return;
+    }
+    auto& members = (*operandView).template getMembers<IntView>();
+    op.operandValues.assign(members.size(), [&](size_t i) {
+        return getOperandValue<minMode>(members[i]);
+    });
+    op.operandValuesValid = true;
+}
+
+// returns true if operandValues may be updated incrementally.  Otherwise
+// refills operandValues from the operand, which then already holds the change
+// the caller was about to apply.
+template <bool minMode>
+inline bool operandValuesInSync(OpMinMax<minMode>& op) {
+    if (op.operandValuesValid) {
+        return true;
+    }
+    refreshOperandValues(op);
+    return false;
+}
+
 template <bool minMode>
 void OpMinMax<minMode>::reevaluateImpl(SequenceView&) {
     minValueIndices.clear();
@@ -44,10 +79,15 @@ void triggerChange(OpMinMax<minMode>& op, bool wasDefined, Int oldValue) {
     }
 }
 
+// recomputes the min/max and its indices from operandValues, refilling
+// operandValues from the operand first if refreshOperandValues is set.
 template <bool minMode>
-inline void updateMinValues(OpMinMax<minMode>& op, bool trigger) {
+inline void updateMinValues(OpMinMax<minMode>& op, bool trigger,
+                            bool refreshOperandValues) {
     bool wasDefined = op.isDefined();
-
+    if (refreshOperandValues) {
+        ::refreshOperandValues(op);
+    }
     auto operandView = op.operand->getViewIfDefined();
     if (!operandView) {
         op.setDefined(false);
@@ -55,31 +95,33 @@ inline void updateMinValues(OpMinMax<minMode>& op, bool trigger) {
         return;
     }
     auto& members = (*operandView).template getMembers<IntView>();
-    bool foundUndefined = false;
+    auto& values = op.operandValues;
+    debug_code(assert(values.size() == members.size()));
     Int oldValue = op.value;
-    for (size_t i = 0; i < members.size(); ++i) {
-        auto& operandChild = members[i];
-        auto operandChildView = operandChild->getViewIfDefined();
-        if (!operandChildView) {
-            foundUndefined = true;
-            continue;
-        }
-        Int operandValue = operandChildView->value;
-        if (op.minValueIndices.empty() || op.compare(operandValue, op.value)) {
-            op.value = operandValue;
-            op.minValueIndices.clear();
-            op.minValueIndices.insert(i);
-        } else if (operandValue == op.value) {
-            op.minValueIndices.insert(i);
+    op.minValueIndices.clear();
+    if (!values.empty()) {
+        Int bestValue = values.best();
+        // only if the best value equals the placeholder for undefined
+        // operands must the operands themselves be checked
+        bool checkDefined = bestValue == values.identity();
+        values.forEachBest([&](size_t i) {
+            if (!checkDefined || members[i]->appearsDefined()) {
+                op.minValueIndices.insert(i);
+            }
+        });
+        if (!op.minValueIndices.empty()) {
+            op.value = bestValue;
         }
     }
-    op.setDefined(!foundUndefined && !op.minValueIndices.empty());
+    op.setDefined((*operandView).numberUndefined == 0 &&
+                  !op.minValueIndices.empty());
     if (trigger) {
         triggerChange(op, wasDefined, oldValue);
     }
 }
 
-// returns true if the function did a full revaluate of the OpMinMax node
+// returns true if the function did a full revaluate of the OpMinMax node.
+// operandValues[index] must already hold the new value.
 template <bool minMode>
 inline bool handleOperandValueChange(OpMinMax<minMode>& op, Int index) {
     const ExprRef<IntView> expr =
@@ -100,9 +142,9 @@ inline bool handleOperandValueChange(OpMinMax<minMode>& op, Int index) {
         // otherwise value is greater, needs to be removed
         op.minValueIndices.erase(index);
         if (op.minValueIndices.size() == 0) {
-            // new min needs to be found
+            // new min needs to be found, operandValues is up to date
             fullReevaluate = true;
-            op.reevaluate();
+            updateMinValues(op, false, false);
         }
     }
     return fullReevaluate;
@@ -110,16 +152,22 @@ inline bool handleOperandValueChange(OpMinMax<minMode>& op, Int index) {
 template <bool minMode>
 void OpMinMax<minMode>::handleMemberUndefined(UInt index) {
     this->setUndefinedAndTrigger();
+    if (operandValuesInSync(*this)) {
+        operandValues.set(index, operandValues.identity());
+    }
     if (minValueIndices.count(index)) {
         minValueIndices.erase(index);
     }
     if (minValueIndices.empty()) {
-        updateMinValues(*this, true);
+        updateMinValues(*this, true, false);
     }
 }
 template <bool minMode>
 void OpMinMax<minMode>::handleMemberDefined(UInt index) {
     auto& expr = this->operand->view()->template getMembers<IntView>()[index];
+    if (operandValuesInSync(*this)) {
+        operandValues.set(index, getOperandValue<minMode>(expr));
+    }
     auto exprView = expr->getViewIfDefined();
     if (!exprView) {
         return;
@@ -158,6 +206,9 @@ class OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger
     void valueAdded(UInt index, const AnyExprRef& exprIn) final {
         auto& expr = lib::get<ExprRef<IntView>>(exprIn);
         auto view = expr->getViewIfDefined();
+        if (operandValuesInSync(*op)) {
+            op->operandValues.insert(index, getOperandValue<minMode>(expr));
+        }
 
         // if is better
         if (view && (op->minValueIndices.empty() ||
@@ -182,6 +233,9 @@ class OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger
     }
 
     void valueRemoved(UInt index, const AnyExprRef&) final {
+        if (operandValuesInSync(*op)) {
+            op->operandValues.erase(index);
+        }
         if (op->minValueIndices.count(index)) {
             op->minValueIndices.erase(index);
         }
@@ -189,11 +243,14 @@ class OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger
             shiftIndicesDown(index, op->operand->view()->numberElements(),
                              op->minValueIndices);
         } else {
-            updateMinValues(*op, true);
+            updateMinValues(*op, true, false);
         }
     }
 
     inline void positionsSwapped(UInt index1, UInt index2) {
+        if (operandValuesInSync(*op)) {
+            op->operandValues.swap(index1, index2);
+        }
         if (op->minValueIndices.count(index1)) {
             if (!op->minValueIndices.count(index2)) {
                 op->minValueIndices.erase(index1);
@@ -210,6 +267,12 @@ class OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger
         subsequenceChanged(index, index + 1);
     }
     inline void subsequenceChanged(UInt startIndex, UInt endIndex) final {
+        auto& members = op->operand->view()->template getMembers<IntView>();
+        if (operandValuesInSync(*op)) {
+            for (size_t i = startIndex; i < endIndex; i++) {
+                op->operandValues.set(i, getOperandValue<minMode>(members[i]));
+            }
+        }
         op->changeValue([&]() {
             for (size_t i = startIndex; i < endIndex; i++) {
                 bool fullReevaluated = handleOperandValueChange(*op, i);
@@ -226,12 +289,15 @@ class OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger
         updateMinValues(*op, true);
     }
     void reattachTrigger() final {
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OperatorTrates<OpMinMax<minMode>>::OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
-    void hasBecomeUndefined() final { op->setUndefinedAndTrigger(); }
+    void hasBecomeUndefined() final {
+        op->operandValuesValid = false;
+        op->setUndefinedAndTrigger();
+    }
     void hasBecomeDefined() final { op->reevaluateDefinedAndTrigger(); }
     void memberHasBecomeUndefined(UInt index) final {
         op->handleMemberUndefined(index);
@@ -259,6 +325,8 @@ template <bool minMode>
 void OpMinMax<minMode>::copy(OpMinMax<minMode>& newOp) const {
     newOp.value = this->value;
     newOp.minValueIndices = minValueIndices;
+    newOp.operandValues = operandValues;
+    newOp.operandValuesValid = operandValuesValid;
 }
 template <bool minMode>
 std::ostream& OpMinMax<minMode>::dumpState(std::ostream& os) const {
@@ -292,6 +360,13 @@ void OpMinMax<minMode>::debugSanityCheckImpl() const {
         return;
     }
     auto& members = (*operandView).template getMembers<IntView>();
+    if (operandValuesValid) {
+        sanityEqualsCheck(members.size(), operandValues.size());
+        for (size_t i = 0; i < members.size(); ++i) {
+            sanityEqualsCheck(getOperandValue<minMode>(members[i]),
+                              operandValues[i]);
+        }
+    }
     FastIterableIntSet checkMinValueIndices(0, 0);
     Int checkValue;
     for (size_t i = 0; i < members.size(); ++i) {
@@ -348,7 +423,7 @@ ExprRef<IntView> OpMaker<OpMinMax<minMode>>::make(
         // construct empty sequence of type int
         return OpMaker<OpUndefined<IntView>>::make();
     }
-    return make_shared<OpMinMax<minMode>>(move(o));
+    return makeShared<OpMinMax<minMode>>(move(o));
 }
 
 template struct OpMinMax<true>;
@@ -7,6 +7,7 @@
 #include "types/int.h"
 #include "types/sequence.h"
 #include "utils/fastIterableIntSet.h"
+#include "utils/minMaxSegmentTree.h"
 template <bool minMode>
 struct OpMinMax;
 template <bool minMode>
@@ -21,6 +22,14 @@ struct OpMinMax
     using SimpleUnaryOperator<IntView, SequenceView,
                               OpMinMax<minMode>>::SimpleUnaryOperator;
     FastIterableIntSet minValueIndices = FastIterableIntSet(0, 0);
+    // copy of the operand values, undefined operands hold the largest (min
+    // mode) or smallest (max mode) Int.  Lets the new min/max be found in
+    // O(log n) when the last operand holding the current one changes.
+    MinMaxSegmentTree<minMode> operandValues;
+    // false while operandValues does not mirror the operand, e.g. after the
+    // operand became undefined.  Incremental updates are then replaced by a
+    // refill.
+    bool operandValuesValid = false;
 
     void reevaluateImpl(SequenceView& sequenceView);
     void updateVarViolationsImpl(const ViolationContext& vioContext,
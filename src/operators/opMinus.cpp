@@ -16,7 +16,7 @@ void OpMinus::updateVarViolationsImpl(const ViolationContext& vioContext,
     left->updateVarViolations(vioContext, vioContainer);
     if (intVioContext) {
         right->updateVarViolations(
-            IntViolationContext(intVioContext->parentViolation,
+            IntViolationContext(*intVioContext,
                                 (intVioContext->reason == Reason::TOO_LARGE)
                                     ? Reason::TOO_SMALL
                                     : Reason::TOO_LARGE),
@@ -61,5 +61,5 @@ struct OpMaker<OpMinus> {
 
 ExprRef<IntView> OpMaker<OpMinus>::make(ExprRef<IntView> l,
                                         ExprRef<IntView> r) {
-    return make_shared<OpMinus>(move(l), move(r));
+    return makeShared<OpMinus>(move(l), move(r));
 }
@@ -74,5 +74,5 @@ struct OpMaker<OpMod> {
 };
 
 ExprRef<IntView> OpMaker<OpMod>::make(ExprRef<IntView> l, ExprRef<IntView> r) {
-    return make_shared<OpMod>(move(l), move(r));
+    return makeShared<OpMod>(move(l), move(r));
 }
@@ -12,7 +12,7 @@ void OpNegate::updateVarViolationsImpl(const ViolationContext& vioContext,
         dynamic_cast<const IntViolationContext*>(&vioContext);
     if (intVioContextTest) {
         this->operand->updateVarViolations(
-            IntViolationContext(intVioContextTest->parentViolation,
+            IntViolationContext(*intVioContextTest,
                                 (intVioContextTest->reason == TOO_LARGE)
                                     ? TOO_SMALL
                                     : TOO_LARGE),
@@ -50,5 +50,5 @@ struct OpMaker<OpNegate> {
 };
 
 ExprRef<IntView> OpMaker<OpNegate>::make(ExprRef<IntView> o) {
-    return make_shared<OpNegate>(move(o));
+    return makeShared<OpNegate>(move(o));
 }
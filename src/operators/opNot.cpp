@@ -13,7 +13,7 @@ void OpNot::updateVarViolationsImpl(const ViolationContext& vioContext,
     bool alreadyNegated = boolVioContextTest && boolVioContextTest->negated;
 
     this->operand->updateVarViolations(
-        BoolViolationContext(vioContext.parentViolation, !alreadyNegated),
+        BoolViolationContext(vioContext, !alreadyNegated),
         vioContainer);
 }
 
@@ -47,5 +47,5 @@ struct OpMaker<OpNot> {
 };
 
 ExprRef<BoolView> OpMaker<OpNot>::make(ExprRef<BoolView> o) {
-    return make_shared<OpNot>(move(o));
+    return makeShared<OpNot>(move(o));
 }
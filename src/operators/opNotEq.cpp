@@ -15,6 +15,20 @@ void OpNotEq<OperandView>::reevaluateImpl(OperandView& leftView,
         (getValueHash(leftView) == getValueHash(rightView)) ? 1 : 0;
 }
 
+template <typename OperandView>
+bool OpNotEq<OperandView>::peekChange() {
+    return false;
+}
+
+template <>
+bool OpNotEq<IntView>::peekChange() {
+    if (!allOperandsAreDefined()) {
+        return false;
+    }
+    return peekViolationAndNotify(
+        (peekValue(*left->view()) == peekValue(*right->view())) ? 1 : 0);
+}
+
 template <typename OperandView>
 void OpNotEq<OperandView>::updateVarViolationsImpl(
     const ViolationContext&, ViolationContainer& vioContainer) {
@@ -68,7 +82,7 @@ struct OpMaker<OpNotEq<OperandView>> {
 template <typename OperandView>
 ExprRef<BoolView> OpMaker<OpNotEq<OperandView>>::make(ExprRef<OperandView> l,
                                                       ExprRef<OperandView> r) {
-    return make_shared<OpNotEq<OperandView>>(move(l), move(r));
+    return makeShared<OpNotEq<OperandView>>(move(l), move(r));
 }
 
 #define opNotEqInstantiators(name)       \
@@ -4,6 +4,7 @@
 #include "operators/simpleOperator.h"
 #include "operators/simpleTrigger.h"
 #include "types/bool.h"
+#include "types/int.h"
 #include "types/set.h"
 template <typename OperandView>
 struct OpNotEq;
@@ -24,6 +25,8 @@ struct OpNotEq : public SimpleBinaryOperator<BoolView, OperandView, OperandView,
 
     void reevaluateImpl(OperandView& leftView, OperandView& rightView, bool,
                         bool);
+    // only supported for ints
+    bool peekChange();
     void updateVarViolationsImpl(const ViolationContext& vioContext,
                                  ViolationContainer& vioContainer) final;
     void copy(OpNotEq& newOp) const;
@@ -31,4 +34,6 @@ struct OpNotEq : public SimpleBinaryOperator<BoolView, OperandView, OperandView,
     std::string getOpName() const final;
     void debugSanityCheckImpl() const final;
 };
+template <>
+bool OpNotEq<IntView>::peekChange();
 #endif /* SRC_OPERATORS_OPNOTEQ_H_ */
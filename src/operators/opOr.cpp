@@ -152,7 +152,7 @@ class OperatorTrates<OpOr>::OperandsSequenceTrigger : public SequenceTrigger {
         });
     }
     void reattachTrigger() final {
-        auto trigger = make_shared<OperandsSequenceTrigger>(op);
+        auto trigger = makeShared<OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -254,5 +254,5 @@ ExprRef<BoolView> OpMaker<OpOr>::make(
         return val.asExpr();
     }
 
-    return make_shared<OpOr>(move(o));
+    return makeShared<OpOr>(move(o));
 }
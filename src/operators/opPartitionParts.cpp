@@ -19,7 +19,7 @@ void OpPartitionParts::reevaluateImpl(PartitionView& operand) {
             for (size_t i = 0; i < operandMembers.size(); i++) {
                 auto part = operand.memberPartMap[i];
                 if (partSetMap[part] == -1) {
-                    auto newPart = make_shared<Part>();
+                    auto newPart = makeShared<Part>();
                     newPart->members.emplace<ExprRefVec<View>>();
                     newPart->addMember(operandMembers[i]);
                     this->addMember<SetView>(newPart);
@@ -52,7 +52,7 @@ struct OperatorTrates<OpPartitionParts>::OperandTrigger
 
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpPartitionParts>::OperandTrigger>(op);
+            makeShared<OperatorTrates<OpPartitionParts>::OperandTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -128,7 +128,7 @@ struct OperatorTrates<OpPartitionParts>::OperandTrigger
 
                 auto destSetIndex = op->partSetMap[destPart];
                 bool newSet = destSetIndex == -1;
-                auto part = (newSet) ? ExprRef<SetView>(make_shared<Part>())
+                auto part = (newSet) ? ExprRef<SetView>(makeShared<Part>())
                                      : op->getMembers<SetView>()[destSetIndex];
                 auto& partView = *getAs<Part>(part);
                 if (newSet) {
@@ -198,7 +198,7 @@ struct OperatorTrates<OpPartitionParts>::OperandTrigger
                     }
                     auto destSetIndex = op->partSetMap[destPart];
                     if (destSetIndex == -1) {
-                        auto part = make_shared<Part>();
+                        auto part = makeShared<Part>();
                         part->members.emplace<ExprRefVec<View>>();
                         part->addMemberAndNotify(member);
                         addPartAndNotify(destPart, ExprRef<SetView>(part));
@@ -290,5 +290,5 @@ struct OpMaker<OpPartitionParts> {
 };
 
 ExprRef<SetView> OpMaker<OpPartitionParts>::make(ExprRef<PartitionView> o) {
-    return make_shared<OpPartitionParts>(move(o));
+    return makeShared<OpPartitionParts>(move(o));
 }
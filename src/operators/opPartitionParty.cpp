@@ -92,7 +92,7 @@ struct OperatorTrates<OpPartitionParty<OperandView>>::LeftTrigger
     void adapterHasBecomeUndefined() { todoImpl(); }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OperatorTrates<OpPartitionParty<OperandView>>::LeftTrigger>(op);
         op->left->addTrigger(trigger);
         op->leftTrigger = trigger;
@@ -196,7 +196,7 @@ struct OperatorTrates<OpPartitionParty<OperandView>>::RightTrigger
     void memberHasBecomeUndefined() { todoImpl(); }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OperatorTrates<OpPartitionParty<OperandView>>::RightTrigger>(op);
         op->right->addTrigger(trigger);
         op->rightTrigger = trigger;
@@ -292,7 +292,7 @@ struct OpMaker<OpPartitionParty<OperandView>> {
 template <typename OperandView>
 ExprRef<SetView> OpMaker<OpPartitionParty<OperandView>>::make(
     ExprRef<OperandView> l, ExprRef<PartitionView> r) {
-    return make_shared<OpPartitionParty<OperandView>>(move(l), move(r));
+    return makeShared<OpPartitionParty<OperandView>>(move(l), move(r));
 }
 
 #define opMakerInstantiator(name)                                          \
@@ -43,5 +43,5 @@ struct OpMaker<OpPartitionSize> {
 };
 
 ExprRef<IntView> OpMaker<OpPartitionSize>::make(ExprRef<PartitionView> o) {
-    return make_shared<OpPartitionSize>(move(o));
+    return makeShared<OpPartitionSize>(move(o));
 }
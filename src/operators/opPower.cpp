@@ -98,5 +98,5 @@ struct OpMaker<OpPower> {
 
 ExprRef<IntView> OpMaker<OpPower>::make(ExprRef<IntView> l,
                                         ExprRef<IntView> r) {
-    return make_shared<OpPower>(move(l), move(r));
+    return makeShared<OpPower>(move(l), move(r));
 }
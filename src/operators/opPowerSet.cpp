@@ -27,7 +27,7 @@ struct OperatorTrates<OpPowerSet>::OperandTrigger
 
     void reattachTrigger() {
         auto newTrigger =
-            std::make_shared<OperatorTrates<OpPowerSet>::OperandTrigger>(op);
+            makeShared<OperatorTrates<OpPowerSet>::OperandTrigger>(op);
         op->operand->addTrigger(newTrigger);
         op->operandTrigger = newTrigger;
     }
@@ -62,5 +62,5 @@ struct OpMaker<OpPowerSet> {
 };
 
 ExprRef<SetView> OpMaker<OpPowerSet>::make(ExprRef<SetView> o) {
-    return make_shared<OpPowerSet>(move(o));
+    return makeShared<OpPowerSet>(move(o));
 }
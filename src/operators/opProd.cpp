@@ -11,6 +11,7 @@
 #include "types/intVal.h"
 #include "types/sequenceVal.h"
 #include "utils/ignoreUnused.h"
+#include "utils/simdKernels.h"
 using namespace std;
 using OperandsSequenceTrigger = OperatorTrates<OpProd>::OperandsSequenceTrigger;
 
@@ -146,7 +147,7 @@ class OperatorTrates<OpProd>::OperandsSequenceTrigger : public SequenceTrigger {
     }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<OperandsSequenceTrigger>(op);
+        auto trigger = makeShared<OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -197,23 +198,22 @@ class OperatorTrates<OpProd>::OperandsSequenceTrigger : public SequenceTrigger {
 
 void OpProd::reevaluateImpl(SequenceView& operandView) {
     setDefined(true);
-    value = 1;
-    cachedValue = 1;
-    cachedValues.clear();
-    numberZeros = 0;
     auto& members = operandView.getMembers<IntView>();
+    auto& values = cachedValues.contents;
+    values.resize(members.size());
     for (size_t index = 0; index < members.size(); index++) {
         auto& operandChild = members[index];
         auto operandChildView = operandChild->getViewIfDefined();
         if (!operandChildView) {
             setDefined(false);
-            cachedValues.insert(index, 1);
+            values[index] = 1;
         } else {
-            Int operandValue = operandChildView->value;
-            addSingleValue(operandValue);
-            cachedValues.insert(index, operandValue);
+            values[index] = operandChildView->value;
         }
     }
+    numberZeros = simd::countEqual(values.data(), values.size(), 0);
+    cachedValue = simd::productOfNonZero(values.data(), values.size());
+    value = (numberZeros > 0) ? 0 : cachedValue;
     evaluationComplete = true;
 }
 
@@ -298,5 +298,5 @@ ExprRef<IntView> OpMaker<OpProd>::make(
         val->setConstant(true);
         return val.asExpr();
     }
-    return make_shared<OpProd>(move(o));
+    return makeShared<OpProd>(move(o));
 }
@@ -216,7 +216,7 @@ struct OpSequenceIndex<SequenceMemberViewType>::SequenceOperandTrigger
         if (op->memberTrigger) {
             deleteTrigger(op->memberTrigger);
         }
-        auto trigger = make_shared<SequenceOperandTrigger>(op);
+        auto trigger = makeShared<SequenceOperandTrigger>(op);
         op->sequenceOperand->addTrigger(trigger, false);
         if (op->locallyDefined) {
             op->reattachSequenceMemberTrigger();
@@ -239,7 +239,7 @@ struct OpSequenceIndex<SequenceMemberViewType>::IndexTrigger
     void reattachTrigger() final {
         deleteTrigger(op->indexTrigger);
         auto trigger =
-            make_shared<OpSequenceIndex<SequenceMemberViewType>::IndexTrigger>(
+            makeShared<OpSequenceIndex<SequenceMemberViewType>::IndexTrigger>(
                 op);
         op->indexOperand->addTrigger(trigger);
         op->indexTrigger = trigger;
@@ -265,7 +265,7 @@ struct OpSequenceIndex<SequenceMemberViewType>::MemberTrigger
     }
     void reattachTrigger() final {
         deleteTrigger(this->op->memberTrigger);
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             typename OpSequenceIndex<SequenceMemberViewType>::MemberTrigger>(
             this->op);
         this->op->getMember().get()->addTrigger(trigger);
@@ -279,12 +279,12 @@ template <typename SequenceMemberViewType>
 void OpSequenceIndex<SequenceMemberViewType>::startTriggeringImpl() {
     if (!indexTrigger) {
         indexTrigger =
-            make_shared<OpSequenceIndex<SequenceMemberViewType>::IndexTrigger>(
+            makeShared<OpSequenceIndex<SequenceMemberViewType>::IndexTrigger>(
                 this);
         indexOperand->addTrigger(indexTrigger);
         indexOperand->startTriggering();
 
-        sequenceOperandTrigger = make_shared<
+        sequenceOperandTrigger = makeShared<
             OpSequenceIndex<SequenceMemberViewType>::SequenceOperandTrigger>(
             this);
         sequenceOperand->addTrigger(sequenceOperandTrigger, false);
@@ -303,9 +303,9 @@ void OpSequenceIndex<SequenceMemberViewType>::reattachSequenceMemberTrigger() {
     if (memberTrigger) {
         deleteTrigger(memberTrigger);
     }
-    sequenceMemberTrigger = make_shared<SequenceOperandTrigger>(this);
+    sequenceMemberTrigger = makeShared<SequenceOperandTrigger>(this);
     sequenceOperand->addTrigger(sequenceMemberTrigger, true, cachedIndex);
-    memberTrigger = make_shared<
+    memberTrigger = makeShared<
         typename OpSequenceIndex<SequenceMemberViewType>::MemberTrigger>(this);
     getMember().get()->addTrigger(memberTrigger);
 }
@@ -355,7 +355,7 @@ ExprRef<SequenceMemberViewType>
 OpSequenceIndex<SequenceMemberViewType>::deepCopyForUnrollImpl(
     const ExprRef<SequenceMemberViewType>&, const AnyIterRef& iterator) const {
     auto newOpSequenceIndex =
-        make_shared<OpSequenceIndex<SequenceMemberViewType>>(
+        makeShared<OpSequenceIndex<SequenceMemberViewType>>(
             sequenceOperand->deepCopyForUnroll(sequenceOperand, iterator),
             indexOperand->deepCopyForUnroll(indexOperand, iterator));
     return newOpSequenceIndex;
@@ -388,7 +388,7 @@ pair<bool, ExprRef<SequenceMemberViewType>>
 OpSequenceIndex<SequenceMemberViewType>::optimiseImpl(
     ExprRef<SequenceMemberViewType>&, PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpSequenceIndex<SequenceMemberViewType>>(
+    auto newOp = makeShared<OpSequenceIndex<SequenceMemberViewType>>(
         sequenceOperand, indexOperand);
     AnyExprRef newOpAsExpr = ExprRef<SequenceMemberViewType>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->sequenceOperand, path);
@@ -449,7 +449,7 @@ struct OpMaker<OpSequenceIndex<View>> {
 template <typename View>
 ExprRef<View> OpMaker<OpSequenceIndex<View>>::make(
     ExprRef<SequenceView> sequence, ExprRef<IntView> index) {
-    return make_shared<OpSequenceIndex<View>>(move(sequence), move(index));
+    return makeShared<OpSequenceIndex<View>>(move(sequence), move(index));
 }
 
 #define opSequenceIndexInstantiators(name)       \
@@ -40,11 +40,14 @@ struct ExprTrigger
         this->op->template changeSubsequenceAndNotify<View>(this->index,
                                                             this->index + 1);
     }
+    bool adapterPeekValueChanged() {
+        return this->op->notifyPeekMemberChanged(this->index);
+    }
 
     void reattachTrigger() final {
         deleteTrigger(static_pointer_cast<ExprTrigger<TriggerType>>(
             op->exprTriggers[index]));
-        auto trigger = make_shared<ExprTrigger<TriggerType>>(op, index);
+        auto trigger = makeShared<ExprTrigger<TriggerType>>(op, index);
         op->getMembers<typename AssociatedViewType<TriggerType>::type>()[index]
             ->addTrigger(trigger);
         op->exprTriggers[index] = trigger;
@@ -67,7 +70,7 @@ void OpSequenceLit::startTriggeringImpl() {
                     TriggerType;
                 for (size_t i = 0; i < members.size(); i++) {
                     auto trigger =
-                        make_shared<ExprTrigger<TriggerType>>(this, i);
+                        makeShared<ExprTrigger<TriggerType>>(this, i);
                     members[i]->addTrigger(trigger);
                     exprTriggers.emplace_back(move(trigger));
                     members[i]->startTriggering();
@@ -129,7 +132,7 @@ ExprRef<SequenceView> OpSequenceLit::deepCopyForUnrollImpl(
         },
         members);
 
-    auto newOpSequenceLit = make_shared<OpSequenceLit>(move(newMembers));
+    auto newOpSequenceLit = makeShared<OpSequenceLit>(move(newMembers));
     return newOpSequenceLit;
 }
 
@@ -166,7 +169,7 @@ void OpSequenceLit::findAndReplaceSelf(const FindAndReplaceFunction& func,
 
 pair<bool, ExprRef<SequenceView>> OpSequenceLit::optimiseImpl(
     ExprRef<SequenceView>&, PathExtension path) {
-    auto newOp = make_shared<OpSequenceLit>(members);
+    auto newOp = makeShared<OpSequenceLit>(members);
     AnyExprRef newOpAsExpr = ExprRef<SequenceView>(newOp);
     bool optimised = false;
     lib::visit(
@@ -208,5 +211,5 @@ struct OpMaker<OpSequenceLit> {
 };
 
 ExprRef<SequenceView> OpMaker<OpSequenceLit>::make(AnyExprVec o) {
-    return make_shared<OpSequenceLit>(move(o));
+    return makeShared<OpSequenceLit>(move(o));
 }
@@ -11,7 +11,9 @@ struct OpSequenceLit : public SequenceView {
     };
     std::vector<std::shared_ptr<ExprTriggerBase>> exprTriggers;
 
-    OpSequenceLit(AnyExprVec members) : SequenceView(std::move(members)) {}
+    OpSequenceLit(AnyExprVec members) : SequenceView(std::move(members)) {
+        this->batchable = true;
+    }
     OpSequenceLit(const OpSequenceLit&) = delete;
     OpSequenceLit(OpSequenceLit&&) = delete;
     ~OpSequenceLit() { this->stopTriggeringOnChildren(); }
@@ -43,5 +43,5 @@ struct OpMaker<OpSequenceSize> {
 };
 
 ExprRef<IntView> OpMaker<OpSequenceSize>::make(ExprRef<SequenceView> o) {
-    return make_shared<OpSequenceSize>(move(o));
+    return makeShared<OpSequenceSize>(move(o));
 }
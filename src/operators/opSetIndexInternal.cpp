@@ -199,7 +199,7 @@ struct OpSetIndexInternal<SetMemberViewType>::SetOperandTrigger
         deleteTrigger(op->setOperandTrigger);
         deleteTrigger(op->setMemberTrigger);
         deleteTrigger(op->memberTrigger);
-        auto trigger = make_shared<SetOperandTrigger>(op);
+        auto trigger = makeShared<SetOperandTrigger>(op);
         op->setOperand->addTrigger(trigger, false);
         op->reattachSetMemberTrigger();
         op->setOperandTrigger = trigger;
@@ -222,7 +222,7 @@ struct OpSetIndexInternal<SetMemberViewType>::MemberTrigger
     }
     void reattachTrigger() final {
         deleteTrigger(this->op->memberTrigger);
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             typename OpSetIndexInternal<SetMemberViewType>::MemberTrigger>(
             this->op);
         this->op->getMember().get()->addTrigger(trigger);
@@ -233,7 +233,7 @@ struct OpSetIndexInternal<SetMemberViewType>::MemberTrigger
 template <typename SetMemberViewType>
 void OpSetIndexInternal<SetMemberViewType>::startTriggeringImpl() {
     if (!setOperandTrigger) {
-        setOperandTrigger = make_shared<
+        setOperandTrigger = makeShared<
             OpSetIndexInternal<SetMemberViewType>::SetOperandTrigger>(this);
         setOperand->addTrigger(setOperandTrigger, false);
         if (exprDefined) {
@@ -248,9 +248,9 @@ void OpSetIndexInternal<SetMemberViewType>::reattachSetMemberTrigger() {
     deleteTrigger(setMemberTrigger);
     deleteTrigger(memberTrigger);
 
-    setMemberTrigger = make_shared<SetOperandTrigger>(this);
+    setMemberTrigger = makeShared<SetOperandTrigger>(this);
     memberTrigger =
-        make_shared<OpSetIndexInternal<SetMemberViewType>::MemberTrigger>(this);
+        makeShared<OpSetIndexInternal<SetMemberViewType>::MemberTrigger>(this);
     if (exprDefined) {
         getMember().get()->addTrigger(memberTrigger);
     }
@@ -293,7 +293,7 @@ ExprRef<SetMemberViewType>
 OpSetIndexInternal<SetMemberViewType>::deepCopyForUnrollImpl(
     const ExprRef<SetMemberViewType>&, const AnyIterRef& iterator) const {
     auto newOpSetIndexInternal =
-        make_shared<OpSetIndexInternal<SetMemberViewType>>(
+        makeShared<OpSetIndexInternal<SetMemberViewType>>(
             setOperand->deepCopyForUnroll(setOperand, iterator), indexOperand);
     return newOpSetIndexInternal;
 }
@@ -323,7 +323,7 @@ pair<bool, ExprRef<SetMemberViewType>>
 OpSetIndexInternal<SetMemberViewType>::optimiseImpl(ExprRef<SetMemberViewType>&,
                                                     PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpSetIndexInternal<SetMemberViewType>>(
+    auto newOp = makeShared<OpSetIndexInternal<SetMemberViewType>>(
         setOperand, indexOperand);
     AnyExprRef newOpAsExpr = ExprRef<SetMemberViewType>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->setOperand, path);
@@ -367,7 +367,7 @@ struct OpMaker<OpSetIndexInternal<View>> {
 template <typename View>
 ExprRef<View> OpMaker<OpSetIndexInternal<View>>::make(ExprRef<SetView> set,
                                                       UInt index) {
-    return make_shared<OpSetIndexInternal<View>>(move(set), index);
+    return makeShared<OpSetIndexInternal<View>>(move(set), index);
 }
 
 #define opSetIndexInternalInstantiators(name)       \
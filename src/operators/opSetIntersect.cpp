@@ -132,7 +132,7 @@ struct OperatorTrates<OpSetIntersect>::OperandTrigger : public SetTrigger {
     }
     void reattachLeftTrigger() {
         auto trigger =
-            make_shared<OperatorTrates<OpSetIntersect>::OperandTrigger<true>>(
+            makeShared<OperatorTrates<OpSetIntersect>::OperandTrigger<true>>(
                 op);
         op->left->addTrigger(trigger);
         op->leftTrigger = trigger;
@@ -140,7 +140,7 @@ struct OperatorTrates<OpSetIntersect>::OperandTrigger : public SetTrigger {
 
     void reattachRightTrigger() {
         auto trigger =
-            make_shared<OperatorTrates<OpSetIntersect>::OperandTrigger<false>>(
+            makeShared<OperatorTrates<OpSetIntersect>::OperandTrigger<false>>(
                 op);
         op->right->addTrigger(trigger);
         op->rightTrigger = trigger;
@@ -161,8 +161,10 @@ void OpSetIntersect::updateVarViolationsImpl(const ViolationContext& vioContext,
         left->updateVarViolations(vioContext, vioContainer);
         right->updateVarViolations(vioContext, vioContainer);
     } else {
-        left->updateVarViolations(vioContext.parentViolation, vioContainer);
-        right->updateVarViolations(vioContext.parentViolation, vioContainer);
+        ViolationContext setContext(vioContext.parentViolation,
+                                    vioContext.isModelViolation);
+        left->updateVarViolations(setContext, vioContainer);
+        right->updateVarViolations(setContext, vioContainer);
         auto leftViewO = left->getViewIfDefined();
         auto rightViewO = right->getViewIfDefined();
         if (!leftViewO || !rightViewO) {
@@ -245,5 +247,5 @@ struct OpMaker<OpSetIntersect> {
 
 ExprRef<SetView> OpMaker<OpSetIntersect>::make(ExprRef<SetView> l,
                                                ExprRef<SetView> r) {
-    return make_shared<OpSetIntersect>(move(l), move(r));
+    return makeShared<OpSetIntersect>(move(l), move(r));
 }
@@ -259,7 +259,7 @@ struct OperatorTrates<OpSetLit<FunctionView>>::OperandTrigger
 
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpSetLit<FunctionView>>::OperandTrigger>(
+            makeShared<OperatorTrates<OpSetLit<FunctionView>>::OperandTrigger>(
                 op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
@@ -315,7 +315,7 @@ struct OperatorTrates<OpSetLit<SequenceView>>::OperandTrigger
 
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpSetLit<SequenceView>>::OperandTrigger>(
+            makeShared<OperatorTrates<OpSetLit<SequenceView>>::OperandTrigger>(
                 op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
@@ -403,7 +403,7 @@ struct OpMaker<OpSetLit<FunctionView>> {
 
 ExprRef<SetView> OpMaker<OpSetLit<FunctionView>>::make(
     ExprRef<FunctionView> o) {
-    return make_shared<OpSetLit<FunctionView>>(move(o));
+    return makeShared<OpSetLit<FunctionView>>(move(o));
 }
 
 template <>
@@ -413,7 +413,7 @@ struct OpMaker<OpSetLit<SequenceView>> {
 
 ExprRef<SetView> OpMaker<OpSetLit<SequenceView>>::make(
     ExprRef<SequenceView> o) {
-    return make_shared<OpSetLit<SequenceView>>(move(o));
+    return makeShared<OpSetLit<SequenceView>>(move(o));
 }
 
 template <typename OperandView>
@@ -67,5 +67,5 @@ struct OpMaker<OpSetSize> {
 };
 
 ExprRef<IntView> OpMaker<OpSetSize>::make(ExprRef<SetView> o) {
-    return make_shared<OpSetSize>(move(o));
+    return makeShared<OpSetSize>(move(o));
 }
@@ -131,7 +131,7 @@ struct OperatorTrates<OpSubsetEq>::LeftTrigger : public SetTrigger {
     }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<OperatorTrates<OpSubsetEq>::LeftTrigger>(op);
+        auto trigger = makeShared<OperatorTrates<OpSubsetEq>::LeftTrigger>(op);
         op->left->addTrigger(trigger);
         op->leftTrigger = trigger;
     }
@@ -211,7 +211,7 @@ struct OperatorTrates<OpSubsetEq>::RightTrigger : public SetTrigger {
     }
     void reattachTrigger() final {
         auto trigger =
-            make_shared<OperatorTrates<OpSubsetEq>::RightTrigger>(op);
+            makeShared<OperatorTrates<OpSubsetEq>::RightTrigger>(op);
         op->right->addTrigger(trigger);
         op->rightTrigger = trigger;
     }
@@ -317,5 +317,5 @@ struct OpMaker<OpSubsetEq> {
 
 ExprRef<BoolView> OpMaker<OpSubsetEq>::make(ExprRef<SetView> l,
                                             ExprRef<SetView> r) {
-    return make_shared<OpSubsetEq>(move(l), move(r));
+    return makeShared<OpSubsetEq>(move(l), move(r));
 }
@@ -237,7 +237,7 @@ struct OpSubstringQuantify<SequenceMemberViewType>::SequenceOperandTrigger
     }
     void reattachTrigger() final {
         deleteTrigger(op->sequenceOperandTrigger);
-        auto trigger = make_shared<SequenceOperandTrigger>(op);
+        auto trigger = makeShared<SequenceOperandTrigger>(op);
         op->sequenceOperand->addTrigger(trigger);
         op->sequenceOperandTrigger = trigger;
     }
@@ -319,7 +319,7 @@ struct OpSubstringQuantify<SequenceMemberViewType>::BoundsTrigger
             (lower) ? op->lowerBoundTrigger : op->upperBoundTrigger;
         deleteTrigger(triggerToReplace);
 
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             OpSubstringQuantify<SequenceMemberViewType>::BoundsTrigger>(op,
                                                                         lower);
         auto& operand = (lower) ? op->lowerBoundOperand : op->upperBoundOperand;
@@ -337,14 +337,14 @@ struct OpSubstringQuantify<SequenceMemberViewType>::BoundsTrigger
 template <typename SequenceMemberViewType>
 void OpSubstringQuantify<SequenceMemberViewType>::startTriggeringImpl() {
     if (!sequenceOperandTrigger) {
-        sequenceOperandTrigger = make_shared<OpSubstringQuantify<
+        sequenceOperandTrigger = makeShared<OpSubstringQuantify<
             SequenceMemberViewType>::SequenceOperandTrigger>(this);
         sequenceOperand->addTrigger(sequenceOperandTrigger);
-        lowerBoundTrigger = make_shared<
+        lowerBoundTrigger = makeShared<
             OpSubstringQuantify<SequenceMemberViewType>::BoundsTrigger>(this,
                                                                         true);
         lowerBoundOperand->addTrigger(lowerBoundTrigger);
-        upperBoundTrigger = make_shared<
+        upperBoundTrigger = makeShared<
             OpSubstringQuantify<SequenceMemberViewType>::BoundsTrigger>(this,
                                                                         false);
         upperBoundOperand->addTrigger(upperBoundTrigger);
@@ -385,7 +385,7 @@ template <typename SequenceMemberViewType>
 ExprRef<SequenceView>
 OpSubstringQuantify<SequenceMemberViewType>::deepCopyForUnrollImpl(
     const ExprRef<SequenceView>&, const AnyIterRef& iterator) const {
-    auto newOp = make_shared<OpSubstringQuantify<SequenceMemberViewType>>(
+    auto newOp = makeShared<OpSubstringQuantify<SequenceMemberViewType>>(
         sequenceOperand->deepCopyForUnroll(sequenceOperand, iterator),
         lowerBoundOperand->deepCopyForUnroll(lowerBoundOperand, iterator),
         upperBoundOperand->deepCopyForUnroll(upperBoundOperand, iterator),
@@ -420,7 +420,7 @@ pair<bool, ExprRef<SequenceView>>
 OpSubstringQuantify<SequenceMemberViewType>::optimiseImpl(
     ExprRef<SequenceView>&, PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpSubstringQuantify<SequenceMemberViewType>>(
+    auto newOp = makeShared<OpSubstringQuantify<SequenceMemberViewType>>(
         sequenceOperand, lowerBoundOperand, upperBoundOperand, windowSize);
     AnyExprRef newOpAsExpr = ExprRef<SequenceView>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->sequenceOperand, path);
@@ -512,7 +512,7 @@ template <typename View>
 ExprRef<SequenceView> OpMaker<OpSubstringQuantify<View>>::make(
     ExprRef<SequenceView> sequence, ExprRef<IntView> lowerBoundOperand,
     ExprRef<IntView> upperBoundOperand, size_t windowSize) {
-    return make_shared<OpSubstringQuantify<View>>(
+    return makeShared<OpSubstringQuantify<View>>(
         move(sequence), move(lowerBoundOperand), move(upperBoundOperand),
         windowSize);
 }
@@ -11,6 +11,7 @@
 #include "types/intVal.h"
 #include "types/sequenceVal.h"
 #include "utils/ignoreUnused.h"
+#include "utils/simdKernels.h"
 using namespace std;
 using OperandsSequenceTrigger = OperatorTrates<OpSum>::OperandsSequenceTrigger;
 
@@ -83,13 +84,6 @@ class OperatorTrates<OpSum>::OperandsSequenceTrigger : public SequenceTrigger {
         return (view) ? (*view).value : 0;
     }
 
-    inline void handleSingleOperandChange(SequenceView& operandView,
-                                          UInt index) {
-        Int newValue = getValueCatchUndef(operandView, index);
-        Int oldValue = op->cachedValues.getAndSet(index, newValue);
-        op->removeSingleValue(oldValue);
-        op->addSingleValue(newValue);
-    }
     void memberReplaced(UInt index, const AnyExprRef&) {
         subsequenceChanged(index, index + 1);
     }
@@ -103,14 +97,33 @@ class OperatorTrates<OpSum>::OperandsSequenceTrigger : public SequenceTrigger {
             return;
         }
         auto& operandView = *view;
+        const Int* values = op->cachedValues.contents.data();
+        size_t numberChanged = endIndex - startIndex;
         op->changeValue([&]() {
+            op->value -= simd::sum(values + startIndex, numberChanged);
             for (size_t i = startIndex; i < endIndex; i++) {
-                handleSingleOperandChange(operandView, i);
+                op->cachedValues.set(i, getValueCatchUndef(operandView, i));
             }
+            op->value += simd::sum(values + startIndex, numberChanged);
             return op->isDefined();
         });
     }
 
+    bool peekMemberChanged(UInt index) final {
+        if (!op->evaluationComplete || !op->isDefined()) {
+            return false;
+        }
+        auto memberView =
+            getMember(op->operand->view().get(), index)->getViewIfDefined();
+        if (!memberView) {
+            return false;
+        }
+        Int newValue = peekValue(*memberView);
+        Int oldValue = peekContext.exchangeSlot(
+            &op->cachedValues, index, op->cachedValues.get(index), newValue);
+        return op->peekValueAndNotify(peekValue(*op) - oldValue + newValue);
+    }
+
     void valueChanged() final {
         bool wasDefined = op->isDefined();
         op->changeValue([&]() {
@@ -125,7 +138,7 @@ class OperatorTrates<OpSum>::OperandsSequenceTrigger : public SequenceTrigger {
     }
 
     void reattachTrigger() final {
-        auto trigger = make_shared<OperandsSequenceTrigger>(op);
+        auto trigger = makeShared<OperandsSequenceTrigger>(op);
         op->operand->addTrigger(trigger);
         op->operandTrigger = trigger;
     }
@@ -176,21 +189,20 @@ class OperatorTrates<OpSum>::OperandsSequenceTrigger : public SequenceTrigger {
 
 void OpSum::reevaluateImpl(SequenceView& operandView) {
     setDefined(true);
-    value = 0;
-    cachedValues.clear();
     auto& members = operandView.getMembers<IntView>();
+    auto& values = cachedValues.contents;
+    values.resize(members.size());
     for (size_t index = 0; index < members.size(); index++) {
         auto& operandChild = members[index];
         auto operandChildView = operandChild->getViewIfDefined();
         if (!operandChildView) {
             setDefined(false);
-            cachedValues.insert(index, 0);
+            values[index] = 0;
         } else {
-            Int operandValue = (*operandChildView).value;
-            addSingleValue(operandValue);
-            cachedValues.insert(index, operandValue);
+            values[index] = (*operandChildView).value;
         }
     }
+    value = simd::sum(values.data(), values.size());
     evaluationComplete = true;
 }
 
@@ -274,5 +286,5 @@ ExprRef<IntView> OpMaker<OpSum>::make(
         return val.asExpr();
     }
 
-    return make_shared<OpSum>(move(o));
+    return makeShared<OpSum>(move(o));
 }
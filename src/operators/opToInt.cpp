@@ -20,8 +20,7 @@ void OpToInt::updateVarViolationsImpl(const ViolationContext& vioContext,
             IntViolationContext::Reason::TOO_LARGE) {
             if (value == 1) {
                 operand->updateVarViolations(
-                    BoolViolationContext(intVioContextTest->parentViolation,
-                                         true),
+                    BoolViolationContext(*intVioContextTest, true),
                     vioContainer);
             }
             return;
@@ -29,8 +28,7 @@ void OpToInt::updateVarViolationsImpl(const ViolationContext& vioContext,
                    IntViolationContext::Reason::TOO_SMALL) {
             if (value == 0) {
                 operand->updateVarViolations(
-                    BoolViolationContext(intVioContextTest->parentViolation,
-                                         false),
+                    BoolViolationContext(*intVioContextTest, false),
                     vioContainer);
             }
             return;
@@ -66,5 +64,5 @@ struct OpMaker<OpToInt> {
 };
 
 ExprRef<IntView> OpMaker<OpToInt>::make(ExprRef<BoolView> o) {
-    return make_shared<OpToInt>(move(o));
+    return makeShared<OpToInt>(move(o));
 }
@@ -129,7 +129,7 @@ struct OperatorTrates<OpTogether>::LeftTrigger : public SetTrigger {
         op->partitionMemberTriggers[index] = nullptr;
         if (partitionView.hashIndexMap.count(hash)) {
             op->partitionMemberTriggers[index] =
-                make_shared<OperatorTrates<OpTogether>::RightTrigger>(op);
+                makeShared<OperatorTrates<OpTogether>::RightTrigger>(op);
             op->right->addTrigger(op->partitionMemberTriggers[index], true,
                                   partitionView.hashIndexMap.at(hash));
         }
@@ -160,7 +160,7 @@ struct OperatorTrates<OpTogether>::LeftTrigger : public SetTrigger {
             op->partitionMemberTriggers[index] = nullptr;
             if (partitionView.hashIndexMap.count(hash)) {
                 op->partitionMemberTriggers[index] =
-                    make_shared<OperatorTrates<OpTogether>::RightTrigger>(op);
+                    makeShared<OperatorTrates<OpTogether>::RightTrigger>(op);
                 op->right->addTrigger(op->partitionMemberTriggers[index], true,
                                       partitionView.hashIndexMap.at(hash));
             }
@@ -204,7 +204,7 @@ static void addTrigger(OpTogether& op, const HashType& hash,
                        PartitionView& view) {
     shared_ptr<OperatorTrates<OpTogether>::RightTrigger> trigger = nullptr;
     if (view.hashIndexMap.count(hash)) {
-        trigger = make_shared<OperatorTrates<OpTogether>::RightTrigger>(&op);
+        trigger = makeShared<OperatorTrates<OpTogether>::RightTrigger>(&op);
         op.right->addTrigger(trigger, true, view.hashIndexMap.at(hash));
     }
     op.partitionMemberTriggers.emplace_back(move(trigger));
@@ -219,7 +219,7 @@ static void reattachAllTriggers(OpTogether& op) {
         return;
     }
     auto& setView = *setViewOption;
-    op.leftTrigger = make_shared<OperatorTrates<OpTogether>::LeftTrigger>(&op);
+    op.leftTrigger = makeShared<OperatorTrates<OpTogether>::LeftTrigger>(&op);
     op.left->addTrigger(op.leftTrigger);
 
     if (!partitionViewOption) {
@@ -227,7 +227,7 @@ static void reattachAllTriggers(OpTogether& op) {
     }
     auto& partitionView = *partitionViewOption;
     op.rightTrigger =
-        make_shared<OperatorTrates<OpTogether>::RightTrigger>(&op);
+        makeShared<OperatorTrates<OpTogether>::RightTrigger>(&op);
     op.right->addTrigger(op.rightTrigger, false, -1);
     for (auto hash : setView.indexHashMap) {
         addTrigger(op, hash, partitionView);
@@ -250,7 +250,7 @@ void OpTogether::stopTriggering() {
     }
 }
 void updateVarViolationsOnSet(SetView& leftView, PartitionView& rightView,
-                              UInt violation,
+                              const ViolationContext& vioContext,
                               ViolationContainer& vioContainer) {
     mpark::visit(
         [&](auto& members) {
@@ -259,10 +259,10 @@ void updateVarViolationsOnSet(SetView& leftView, PartitionView& rightView,
             for (size_t i = 0; i < members.size(); i++) {
                 auto& member = members[i];
                 auto& hash = leftView.indexHashMap[i];
-                member->updateVarViolations(violation, vioContainer);
+                member->updateVarViolations(vioContext, vioContainer);
                 if (rightView.hashIndexMap.count(hash)) {
                     partitionMembers[rightView.hashIndexMap[hash]]
-                        ->updateVarViolations(violation, vioContainer);
+                        ->updateVarViolations(vioContext, vioContainer);
                 }
             }
         },
@@ -273,22 +273,24 @@ void OpTogether::updateVarViolationsImpl(const ViolationContext& vioContext,
                                          ViolationContainer& vioContainer) {
     auto* boolVioContextTest =
         dynamic_cast<const BoolViolationContext*>(&vioContext);
-    UInt violationToReport = (boolVioContextTest && boolVioContextTest->negated)
-                                 ? boolVioContextTest->parentViolation
-                                 : this->violation;
+    ViolationContext contextToReport =
+        (boolVioContextTest && boolVioContextTest->negated)
+            ? ViolationContext(boolVioContextTest->parentViolation,
+                               boolVioContextTest->isModelViolation)
+            : ViolationContext(this->violation);
 
-    if (violationToReport == 0) {
+    if (contextToReport.parentViolation == 0) {
         return;
     } else if (allOperandsAreDefined()) {
         auto& leftView =
             left->getViewIfDefined().checkedGet("should be defined here.");
         auto& rightView =
             right->getViewIfDefined().checkedGet("should be defined here.");
-        updateVarViolationsOnSet(leftView, rightView, violationToReport,
+        updateVarViolationsOnSet(leftView, rightView, contextToReport,
                                  vioContainer);
     } else {
-        left->updateVarViolations(violationToReport, vioContainer);
-        right->updateVarViolations(violationToReport, vioContainer);
+        left->updateVarViolations(contextToReport, vioContainer);
+        right->updateVarViolations(contextToReport, vioContainer);
     }
 }
 
@@ -351,5 +353,5 @@ struct OpMaker<OpTogether> {
 
 ExprRef<BoolView> OpMaker<OpTogether>::make(ExprRef<SetView> l,
                                             ExprRef<PartitionView> r) {
-    return make_shared<OpTogether>(move(l), move(r));
+    return makeShared<OpTogether>(move(l), move(r));
 }
@@ -152,7 +152,7 @@ struct OpTupleIndex<TupleMemberViewType>::TupleOperandTrigger
         if (op->memberTrigger) {
             deleteTrigger(op->memberTrigger);
         }
-        auto trigger = make_shared<TupleOperandTrigger>(op);
+        auto trigger = makeShared<TupleOperandTrigger>(op);
         op->tupleOperand->addTrigger(trigger, false);
         op->reattachTupleMemberTrigger();
         op->tupleOperandTrigger = trigger;
@@ -175,7 +175,7 @@ struct OpTupleIndex<TupleMemberViewType>::MemberTrigger
     }
     void reattachTrigger() final {
         deleteTrigger(this->op->memberTrigger);
-        auto trigger = make_shared<
+        auto trigger = makeShared<
             typename OpTupleIndex<TupleMemberViewType>::MemberTrigger>(
             this->op);
         this->op->getMember().get()->addTrigger(trigger);
@@ -189,7 +189,7 @@ template <typename TupleMemberViewType>
 void OpTupleIndex<TupleMemberViewType>::startTriggeringImpl() {
     if (!tupleOperandTrigger) {
         tupleOperandTrigger =
-            make_shared<OpTupleIndex<TupleMemberViewType>::TupleOperandTrigger>(
+            makeShared<OpTupleIndex<TupleMemberViewType>::TupleOperandTrigger>(
                 this);
         tupleOperand->addTrigger(tupleOperandTrigger, false);
         reattachTupleMemberTrigger();
@@ -205,9 +205,9 @@ void OpTupleIndex<TupleMemberViewType>::reattachTupleMemberTrigger() {
     if (memberTrigger) {
         deleteTrigger(memberTrigger);
     }
-    tupleMemberTrigger = make_shared<TupleOperandTrigger>(this);
+    tupleMemberTrigger = makeShared<TupleOperandTrigger>(this);
     memberTrigger =
-        make_shared<OpTupleIndex<TupleMemberViewType>::MemberTrigger>(this);
+        makeShared<OpTupleIndex<TupleMemberViewType>::MemberTrigger>(this);
     tupleOperand->addTrigger(tupleMemberTrigger, true, indexOperand);
     auto member = getMember();
     if (member) {
@@ -251,7 +251,7 @@ template <typename TupleMemberViewType>
 ExprRef<TupleMemberViewType>
 OpTupleIndex<TupleMemberViewType>::deepCopyForUnrollImpl(
     const ExprRef<TupleMemberViewType>&, const AnyIterRef& iterator) const {
-    auto newOpTupleIndex = make_shared<OpTupleIndex<TupleMemberViewType>>(
+    auto newOpTupleIndex = makeShared<OpTupleIndex<TupleMemberViewType>>(
         tupleOperand->deepCopyForUnroll(tupleOperand, iterator), indexOperand);
     newOpTupleIndex->exprDefined = exprDefined;
     return newOpTupleIndex;
@@ -282,7 +282,7 @@ pair<bool, ExprRef<TupleMemberViewType>>
 OpTupleIndex<TupleMemberViewType>::optimiseImpl(ExprRef<TupleMemberViewType>&,
                                                 PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<OpTupleIndex<TupleMemberViewType>>(tupleOperand,
+    auto newOp = makeShared<OpTupleIndex<TupleMemberViewType>>(tupleOperand,
                                                                 indexOperand);
     AnyExprRef newOpAsExpr = ExprRef<TupleMemberViewType>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->tupleOperand, path);
@@ -326,7 +326,7 @@ struct OpMaker<OpTupleIndex<View>> {
 template <typename View>
 ExprRef<View> OpMaker<OpTupleIndex<View>>::make(ExprRef<TupleView> tuple,
                                                 UInt index) {
-    return make_shared<OpTupleIndex<View>>(move(tuple), index);
+    return makeShared<OpTupleIndex<View>>(move(tuple), index);
 }
 
 #define opTupleIndexInstantiators(name)       \
@@ -47,7 +47,7 @@ struct ExprTrigger
     void reattachTrigger() final {
         deleteTrigger(static_pointer_cast<ExprTrigger<TriggerType>>(
             op->exprTriggers[index]));
-        auto trigger = make_shared<ExprTrigger<TriggerType>>(op, index);
+        auto trigger = makeShared<ExprTrigger<TriggerType>>(op, index);
         lib::get<ExprRef<typename AssociatedViewType<TriggerType>::type>>(
             op->members[index])
             ->addTrigger(trigger);
@@ -73,7 +73,7 @@ void OpTupleLit::replaceMember(UInt index, const AnyExprRef& newMember) {
                 deleteTrigger(static_pointer_cast<ExprTrigger<TriggerType>>(
                     exprTriggers[index]));
                 auto trigger =
-                    make_shared<ExprTrigger<TriggerType>>(this, index);
+                    makeShared<ExprTrigger<TriggerType>>(this, index);
                 member->addTrigger(trigger);
                 exprTriggers[index] = move(trigger);
             }
@@ -92,7 +92,7 @@ void OpTupleLit::startTriggeringImpl() {
                             TriggerType;
 
                     auto trigger =
-                        make_shared<ExprTrigger<TriggerType>>(this, i);
+                        makeShared<ExprTrigger<TriggerType>>(this, i);
                     member->addTrigger(trigger);
                     exprTriggers.emplace_back(move(trigger));
                     member->startTriggering();
@@ -151,7 +151,7 @@ ExprRef<TupleView> OpTupleLit::deepCopyForUnrollImpl(
             },
             member);
     }
-    auto newOpTupleLit = make_shared<OpTupleLit>(move(newMembers));
+    auto newOpTupleLit = makeShared<OpTupleLit>(move(newMembers));
     newOpTupleLit->numberUndefined = numberUndefined;
     return newOpTupleLit;
 }
@@ -182,7 +182,7 @@ void OpTupleLit::findAndReplaceSelf(const FindAndReplaceFunction& func,
 
 pair<bool, ExprRef<TupleView>> OpTupleLit::optimiseImpl(ExprRef<TupleView>&,
                                                         PathExtension path) {
-    auto newOp = make_shared<OpTupleLit>(members);
+    auto newOp = makeShared<OpTupleLit>(members);
     AnyExprRef newOpAsExpr = ExprRef<TupleView>(newOp);
     bool optimised = false;
     for (auto& member : newOp->members) {
@@ -226,5 +226,5 @@ struct OpMaker<OpTupleLit> {
 };
 
 ExprRef<TupleView> OpMaker<OpTupleLit>::make(vector<AnyExprRef> o) {
-    return make_shared<OpTupleLit>(move(o));
+    return makeShared<OpTupleLit>(move(o));
 }
@@ -87,7 +87,7 @@ struct OpMaker<OpUndefined<View>> {
 
 template <typename View>
 ExprRef<View> OpMaker<OpUndefined<View>>::make() {
-    return make_shared<OpUndefined<View>>();
+    return makeShared<OpUndefined<View>>();
 }
 
 #define opUndefinedInstantiators(name)       \
@@ -292,7 +292,7 @@ template <typename ContainerType>
 pair<bool, ExprRef<SequenceView>> Quantifier<ContainerType>::optimiseImpl(
     ExprRef<SequenceView>&, PathExtension path) {
     bool optimised = false;
-    auto newOp = make_shared<Quantifier<ContainerType>>(*this);
+    auto newOp = makeShared<Quantifier<ContainerType>>(*this);
     auto newOpAsExpr = ExprRef<SequenceView>(newOp);
     optimised |= optimise(newOpAsExpr, newOp->container, path);
     if (newOp->condition) {
@@ -1,9 +1,13 @@
 #ifndef SRC_OPERATORS_QUANTIFIER_H_
 #define SRC_OPERATORS_QUANTIFIER_H_
+#include <deque>
+#include <memory>
+
 #include "base/base.h"
 #include "operators/iterator.h"
 #include "types/bool.h"
 #include "types/sequence.h"
+#include "utils/recycleList.h"
 
 inline static UInt64 nextQuantId() {
     static UInt64 quantId = 0;
@@ -34,6 +38,12 @@ struct Quantifier : public SequenceView {
             : op(op), index(index) {}
         virtual ~ExprTriggerBase() {}
     };
+    // an expr rolled because its condition became false.  It is no longer a
+    // member of the quantifier but is kept triggering, so that it can be
+    // reinstated as is if the condition becomes true again.
+    struct CachedExpr {
+        lib::optional<AnyExprRef> expr;
+    };
     // for quantifiers with conditions
     struct UnrolledCondition {
         static const UInt UNASSIGNED_EXPR_INDEX =
@@ -49,6 +59,9 @@ struct Quantifier : public SequenceView {
         UInt exprIndex;
         // the trigger watching this condition
         std::shared_ptr<ExprTriggerBase> trigger;
+        // the expr rolled when this condition last became false, if it is
+        // still cached
+        std::shared_ptr<CachedExpr> cachedExpr;
         UnrolledCondition(ExprRef<BoolView> condition, UInt exprIndex)
             : condition(std::move(condition)),
               cachedValue(this->condition->view()->violation == 0),
@@ -63,6 +76,13 @@ struct Quantifier : public SequenceView {
         }
     };
 
+    // an expr rolled whilst triggering, kept together with its iterator
+    struct RecycledExpr {
+        AnyExprRef expr;
+        AnyIterRef iter;
+    };
+    static const size_t MAX_RECYCLED_EXPRS = 2;
+
     const UInt64 quantId;
     ExprRef<ContainerType> container;
     AnyExprRef expr = ExprRef<BoolView>(nullptr);
@@ -72,12 +92,24 @@ struct Quantifier : public SequenceView {
     std::vector<AnyIterRef> unrolledIterVals;
     std::shared_ptr<ContainerTrigger<ContainerType>> containerTrigger;
     std::vector<std::shared_ptr<ExprTriggerBase>> exprTriggers;
+    // quantifiers without conditions keep the last few rolled exprs alive and
+    // triggering, so that unrolling a new value can reuse one by changing its
+    // iterator instead of deep copying the expr template.  Removing and
+    // adding a member (e.g. a rejected set add) therefore reuses the subtree.
+    RecycleList<RecycledExpr, MAX_RECYCLED_EXPRS> recycledExprs;
+    // quantifiers with conditions cache the exprs of the last few conditions
+    // that became false, oldest first.  Conditions flipping back and forth
+    // then do not deep copy and evaluate the expr template each time.
+    static const size_t MAX_CACHED_EXPRS = 4;
+    std::deque<std::weak_ptr<CachedExpr>> cachedExprs;
     bool optimisedToNotUpdateIndices =
         false;  // when quantifying over a sequence and the index of each
                 // element is not used.
     Quantifier(ExprRef<ContainerType> container,
                const UInt64 id = nextQuantId())
-        : quantId(id), container(std::move(container)) {}
+        : quantId(id), container(std::move(container)) {
+        this->batchable = true;
+    }
     inline void setExpression(AnyExprRef exprIn) {
         expr = std::move(exprIn);
         lib::visit(
@@ -101,7 +133,7 @@ struct Quantifier : public SequenceView {
     bool isQuantifier() const final;
     template <typename T>
     inline IterRef<T> newIterRef() {
-        return std::make_shared<Iterator<T>>(quantId, nullptr);
+        return makeShared<Iterator<T>>(quantId, nullptr);
     }
 
     bool triggering();
@@ -123,9 +155,19 @@ struct Quantifier : public SequenceView {
     template <typename View>
     void unrollExpr(UInt index, ExprRef<View> newView, IterRef<View> iterRef);
 
+    template <typename View>
+    bool unrollRecycledExpr(const QueuedUnrollValue<View>& queuedValue);
+
+    // keep expr, just rolled as the condition at conditionIndex became false
+    void cacheExpr(UInt conditionIndex, AnyExprRef expr);
+    // reinstate the cached expr of the condition at conditionIndex, which has
+    // become true.  Returns false if it has no cached expr.
+    bool unrollCachedExpr(UInt conditionIndex);
+    void clearCachedExprs();
+
     void roll(UInt index);
     UnrolledCondition rollCondition(UInt index);
-    void rollExpr(UInt index);
+    AnyExprRef rollExpr(UInt index);
 
     void notifyContainerMembersSwapped(UInt index1, UInt index2);
 
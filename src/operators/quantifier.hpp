@@ -136,9 +136,98 @@ void Quantifier<ContainerType>::unrollExpr(UInt index, ExprRef<View> newView,
         members);
 }
 
+template <typename ContainerType>
+template <typename View>
+bool Quantifier<ContainerType>::unrollRecycledExpr(
+    const QueuedUnrollValue<View>& queuedValue) {
+    return recycledExprs.take([&](RecycledExpr& recycled) {
+        debug_log("unrolling recycled expr for value "
+                  << queuedValue.value << " at index " << queuedValue.index);
+        auto iterRef = lib::get<IterRef<View>>(recycled.iter);
+        // the recycled expr is still triggering, so it is updated
+        // incrementally rather than evaluated from scratch
+        iterRef->changeValueAndTrigger(queuedValue.value);
+        unrolledIterVals.insert(unrolledIterVals.begin() + queuedValue.index,
+                                iterRef);
+        lib::visit(
+            [&](auto& members) {
+                auto newMember =
+                    lib::get<ExprRef<viewType(members)>>(recycled.expr);
+                if (containerDefined) {
+                    this->addMemberAndNotify(queuedValue.index, newMember);
+                } else {
+                    this->addMember(queuedValue.index, newMember);
+                }
+                this->startTriggeringOnExpr(queuedValue.index, newMember);
+            },
+            members);
+    });
+}
+
+template <typename ContainerType>
+void Quantifier<ContainerType>::cacheExpr(UInt conditionIndex,
+                                          AnyExprRef expr) {
+    if (!triggering()) {
+        return;
+    }
+    while (cachedExprs.size() >= MAX_CACHED_EXPRS) {
+        auto oldest = cachedExprs.front().lock();
+        if (oldest) {
+            oldest->expr = lib::nullopt;
+        }
+        cachedExprs.pop_front();
+    }
+    auto cached = makeShared<CachedExpr>();
+    cached->expr = std::move(expr);
+    unrolledConditions[conditionIndex].cachedExpr = cached;
+    cachedExprs.emplace_back(cached);
+}
+
+template <typename ContainerType>
+bool Quantifier<ContainerType>::unrollCachedExpr(UInt conditionIndex) {
+    auto& cached = unrolledConditions[conditionIndex].cachedExpr;
+    if (!cached || !cached->expr) {
+        cached = nullptr;
+        ++recycleStats.misses;
+        return false;
+    }
+    ++recycleStats.hits;
+    AnyExprRef expr = std::move(*cached->expr);
+    cached = nullptr;
+    UInt exprIndex = unrolledConditions[conditionIndex].exprIndex;
+    debug_log("unrolling cached expr at index " << exprIndex);
+    lib::visit(
+        [&](auto& members) {
+            auto newMember = lib::get<ExprRef<viewType(members)>>(expr);
+            if (containerDefined) {
+                this->addMemberAndNotify(exprIndex, newMember);
+            } else {
+                this->addMember(exprIndex, newMember);
+            }
+            this->startTriggeringOnExpr(exprIndex, newMember);
+        },
+        members);
+    return true;
+}
+
+template <typename ContainerType>
+void Quantifier<ContainerType>::clearCachedExprs() {
+    for (auto& weakCached : cachedExprs) {
+        auto cached = weakCached.lock();
+        if (cached) {
+            cached->expr = lib::nullopt;
+        }
+    }
+    cachedExprs.clear();
+}
+
 template <typename ContainerType>
 template <typename View>
 void Quantifier<ContainerType>::unroll(QueuedUnrollValue<View> queuedValue) {
+    if (!condition && !queuedValue.directUnrollExpr && triggering() &&
+        unrollRecycledExpr(queuedValue)) {
+        return;
+    }
     auto newIter = this->newIterRef<View>();
     if (!queuedValue.directUnrollExpr) {
         unrolledIterVals.insert(unrolledIterVals.begin() + queuedValue.index,
@@ -292,6 +381,8 @@ void Quantifier<ContainerType>::notifyContainerMembersSwapped(UInt index1,
     }
     std::swap(unrolledConditions[index1].cachedValue,
               unrolledConditions[index2].cachedValue);
+    std::swap(unrolledConditions[index1].cachedExpr,
+              unrolledConditions[index2].cachedExpr);
     if (leftConditionTrue && rightConditionTrue) {
         normalExprSwap(*this, unrolledConditions[index1].exprIndex,
                        unrolledConditions[index2].exprIndex);
@@ -307,9 +398,13 @@ void Quantifier<ContainerType>::roll(UInt index) {
     debug_code(assert(index < unrolledIterVals.size()));
     debug_log("rolling index " << index << " with value "
                                << unrolledIterVals[index]);
+    auto iter = std::move(unrolledIterVals[index]);
     unrolledIterVals.erase(unrolledIterVals.begin() + index);
     if (!condition) {
-        rollExpr(index);
+        auto expr = rollExpr(index);
+        if (triggering()) {
+            recycledExprs.save(RecycledExpr{std::move(expr), std::move(iter)});
+        }
     } else {
         auto condition = rollCondition(index);
         if (condition.cachedValue) {
@@ -322,18 +417,19 @@ void Quantifier<ContainerType>::roll(UInt index) {
 }
 
 template <typename ContainerType>
-void Quantifier<ContainerType>::rollExpr(UInt index) {
+AnyExprRef Quantifier<ContainerType>::rollExpr(UInt index) {
     debug_log("Rolling  expr index " << index);
-    lib::visit(
-        [&](auto& members) {
-            if (containerDefined && triggering()) {
-                this->template removeMemberAndNotify<viewType(members)>(index);
-            } else {
-                this->template removeMember<viewType(members)>(index);
-            }
+    return lib::visit(
+        [&](auto& members) -> AnyExprRef {
+            typedef viewType(members) View;
+            ExprRef<View> removedMember =
+                (containerDefined && triggering())
+                    ? this->template removeMemberAndNotify<View>(index)
+                    : this->template removeMember<View>(index);
             if (this->triggering()) {
                 this->stopTriggeringOnExpr(index);
             }
+            return removedMember;
         },
         members);
 }
@@ -354,7 +450,7 @@ Quantifier<ContainerType>::rollCondition(UInt index) {
 template <typename ContainerType>
 ExprRef<SequenceView> Quantifier<ContainerType>::deepCopyForUnrollImpl(
     const ExprRef<SequenceView>&, const AnyIterRef& iterator) const {
-    auto newQuantifier = std::make_shared<Quantifier<ContainerType>>(
+    auto newQuantifier = makeShared<Quantifier<ContainerType>>(
         container->deepCopyForUnroll(container, iterator), quantId);
     if (condition) {
         newQuantifier->condition =
@@ -375,7 +471,7 @@ template <typename View>
 void Quantifier<ContainerType>::startTriggeringOnExpr(UInt index,
                                                       ExprRef<View>& expr) {
     auto trigger =
-        std::make_shared<ExprChangeTrigger<ContainerType, viewType(expr)>>(
+        makeShared<ExprChangeTrigger<ContainerType, viewType(expr)>>(
             this, index);
     exprTriggers.insert(exprTriggers.begin() + index, trigger);
     for (size_t i = index + 1; i < exprTriggers.size(); i++) {
@@ -388,7 +484,7 @@ template <typename ContainerType>
 void Quantifier<ContainerType>::startTriggeringOnCondition(
     UInt index, bool fixUpOtherIndices) {
     auto trigger =
-        std::make_shared<ConditionChangeTrigger<ContainerType>>(this, index);
+        makeShared<ConditionChangeTrigger<ContainerType>>(this, index);
     unrolledConditions[index].trigger = trigger;
     unrolledConditions[index].condition->addTrigger(trigger);
     if (!fixUpOtherIndices) {
@@ -422,7 +518,7 @@ void Quantifier<ContainerType>::startTriggeringImpl() {
     if (containerTrigger) {
         return;
     }
-    containerTrigger = std::make_shared<ContainerTrigger<ContainerType>>(this);
+    containerTrigger = makeShared<ContainerTrigger<ContainerType>>(this);
     container->addTrigger(containerTrigger);
     container->startTriggering();
 
@@ -444,6 +540,9 @@ void Quantifier<ContainerType>::startTriggeringImpl() {
 
 template <typename ContainerType>
 void Quantifier<ContainerType>::stopTriggeringOnChildren() {
+    // recycled and cached exprs are only valid whilst they are triggering
+    recycledExprs.clear();
+    clearCachedExprs();
     if (containerTrigger) {
         deleteTrigger(containerTrigger);
         containerTrigger = nullptr;
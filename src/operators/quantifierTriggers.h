@@ -29,13 +29,16 @@ struct ExprChangeTrigger
             },
             op->members);
     }
+    bool adapterPeekValueChanged() {
+        return op->notifyPeekMemberChanged(index);
+    }
     void reattachTrigger() final {
         auto& triggerToChange = op->exprTriggers.at(index);
         deleteTrigger(
             std::static_pointer_cast<ExprChangeTrigger<ContainerType, View>>(
                 triggerToChange));
         auto trigger =
-            std::make_shared<ExprChangeTrigger<ContainerType, View>>(op, index);
+            makeShared<ExprChangeTrigger<ContainerType, View>>(op, index);
         op->template getMembers<View>()[index]->addTrigger(trigger);
         triggerToChange = trigger;
     }
@@ -92,6 +95,9 @@ struct ConditionChangeTrigger
         std::for_each(unrolledConditions.begin() + index,
                       unrolledConditions.end(),
                       [&](auto& cond) { ++cond.exprIndex; });
+        if (op->unrollCachedExpr(index)) {
+            return;
+        }
         lib::visit(
             [&](auto& unrolledIterVal) {
                 typedef viewType(unrolledIterVal->getValue()) View;
@@ -103,7 +109,8 @@ struct ConditionChangeTrigger
     }
     void handleConditionBecomingFalse() {
         auto& unrolledConditions = op->unrolledConditions;
-        op->rollExpr(unrolledConditions[index].exprIndex);
+        op->cacheExpr(index,
+                      op->rollExpr(unrolledConditions[index].exprIndex));
         std::for_each(unrolledConditions.begin() + index,
                       unrolledConditions.end(),
                       [&](auto& cond) { --cond.exprIndex; });
@@ -115,7 +122,7 @@ struct ConditionChangeTrigger
             std::static_pointer_cast<ConditionChangeTrigger<ContainerType>>(
                 triggerToChange));
         auto trigger =
-            std::make_shared<ConditionChangeTrigger<ContainerType>>(op, index);
+            makeShared<ConditionChangeTrigger<ContainerType>>(op, index);
         getTriggeringOperand()->addTrigger(trigger);
         triggerToChange = trigger;
     }
@@ -106,7 +106,7 @@ struct ContainerTrigger<SequenceView> : public SequenceTrigger {
 
     void reattachTrigger() final {
         deleteTrigger(op->containerTrigger);
-        auto trigger = make_shared<ContainerTrigger<SequenceView>>(op);
+        auto trigger = makeShared<ContainerTrigger<SequenceView>>(op);
         op->container->addTrigger(trigger);
         op->containerTrigger = trigger;
     }
@@ -61,7 +61,7 @@ struct ContainerTrigger<SetView> : public SetTrigger {
     }
     void reattachTrigger() final {
         deleteTrigger(op->containerTrigger);
-        auto trigger = make_shared<ContainerTrigger<SetView>>(op);
+        auto trigger = makeShared<ContainerTrigger<SetView>>(op);
         op->container->addTrigger(trigger);
         op->containerTrigger = trigger;
     }
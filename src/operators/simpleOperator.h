@@ -107,6 +107,9 @@ struct SimpleBinaryOperator : public View,
 
     void evaluateImpl() final;
     void reevaluate(bool leftChange, bool rightChange);
+    // speculative evaluation, see base/peek.h.  Hidden by the operators that
+    // support peeking.
+    inline bool peekChange() { return false; }
     void startTriggeringImpl() override;
     void stopTriggering() override;
     ExprRef<View> deepCopyForUnrollImpl(const ExprRef<View>&,
@@ -145,6 +148,9 @@ struct SimpleUnaryOperator : public View,
         bool = false,
         bool = false);  // ignore bools, they are there to make it easier to
                         // compile between unary and binary ops
+    // speculative evaluation, see base/peek.h.  Hidden by the operators that
+    // support peeking.
+    inline bool peekChange() { return false; }
 
     void startTriggeringImpl() final;
     void stopTriggering() final;
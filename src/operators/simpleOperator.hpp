@@ -34,8 +34,8 @@ template <typename View, typename LeftOperandView, typename RightOperandView,
 void SimpleBinaryOperator<View, LeftOperandView, RightOperandView,
                           Derived>::startTriggeringImpl() {
     if (!leftTrigger) {
-        leftTrigger = std::make_shared<LeftTrigger>(&derived());
-        rightTrigger = std::make_shared<RightTrigger>(&derived());
+        leftTrigger = makeShared<LeftTrigger>(&derived());
+        rightTrigger = makeShared<RightTrigger>(&derived());
         left->addTrigger(leftTrigger);
         right->addTrigger(rightTrigger);
         left->startTriggering();
@@ -60,7 +60,7 @@ ExprRef<View> SimpleBinaryOperator<
     Derived>::deepCopyForUnrollImpl(const ExprRef<View>&,
                                     const AnyIterRef& iterator) const {
     auto newOp =
-        std::make_shared<Derived>(left->deepCopyForUnroll(left, iterator),
+        makeShared<Derived>(left->deepCopyForUnroll(left, iterator),
                                   right->deepCopyForUnroll(right, iterator));
     this->copyDefinedStatus(*newOp);
     derived().copy(*newOp);
@@ -81,7 +81,7 @@ std::pair<bool, std::shared_ptr<Derived>>
 SimpleBinaryOperator<View, LeftOperandView, RightOperandView,
                      Derived>::standardOptimise(ExprRef<View>&,
                                                 PathExtension& path) {
-    auto newOp = std::make_shared<Derived>(left, right);
+    auto newOp = makeShared<Derived>(left, right);
     derived().copy(*newOp);
     bool optimised = false;
     optimised |= optimise(ExprRef<View>(newOp), newOp->left, path);
@@ -145,7 +145,7 @@ void SimpleUnaryOperator<View, OperandView, Derived>::reevaluate(
 template <typename View, typename OperandView, typename Derived>
 void SimpleUnaryOperator<View, OperandView, Derived>::startTriggeringImpl() {
     if (!operandTrigger) {
-        operandTrigger = std::make_shared<OperandTrigger>(&derived());
+        operandTrigger = makeShared<OperandTrigger>(&derived());
         operand->addTrigger(operandTrigger);
         operand->startTriggering();
     }
@@ -162,7 +162,7 @@ template <typename View, typename OperandView, typename Derived>
 ExprRef<View>
 SimpleUnaryOperator<View, OperandView, Derived>::deepCopyForUnrollImpl(
     const ExprRef<View>&, const AnyIterRef& iterator) const {
-    auto newOp = std::make_shared<Derived>(
+    auto newOp = makeShared<Derived>(
         operand->deepCopyForUnroll(operand, iterator));
     this->copyDefinedStatus(*newOp);
     derived().copy(*newOp);
@@ -179,7 +179,7 @@ template <typename View, typename OperandView, typename Derived>
 std::pair<bool, std::shared_ptr<Derived>>
 SimpleUnaryOperator<View, OperandView, Derived>::standardOptimise(
     ExprRef<View>&, PathExtension& path) {
-    auto newOp = std::make_shared<Derived>(operand);
+    auto newOp = makeShared<Derived>(operand);
     derived().copy(*newOp);
     bool optimised = false;
     optimised |= optimise(ExprRef<View>(newOp), newOp->operand, path);
@@ -35,6 +35,8 @@ struct SimpleBinaryTrigger
         }
     }
 
+    inline bool adapterPeekValueChanged() { return op->peekChange(); }
+
     inline void reattachTrigger() final {
         if (isLeftTrigger) {
             reassignLeftTrigger();
@@ -44,13 +46,13 @@ struct SimpleBinaryTrigger
     }
     inline void reassignLeftTrigger() {
         auto newTrigger =
-            std::make_shared<SimpleBinaryTrigger<Op, TriggerType, true>>(op);
+            makeShared<SimpleBinaryTrigger<Op, TriggerType, true>>(op);
         op->left->addTrigger(newTrigger);
         op->leftTrigger = newTrigger;
     }
     inline void reassignRightTrigger() {
         auto newTrigger =
-            std::make_shared<SimpleBinaryTrigger<Op, TriggerType, false>>(op);
+            makeShared<SimpleBinaryTrigger<Op, TriggerType, false>>(op);
         op->right->addTrigger(newTrigger);
         op->rightTrigger = newTrigger;
     }
@@ -91,9 +93,11 @@ struct SimpleUnaryTrigger
         }
     }
 
+    inline bool adapterPeekValueChanged() { return op->peekChange(); }
+
     void reattachTrigger() {
         auto newTrigger =
-            std::make_shared<SimpleUnaryTrigger<Op, TriggerType>>(op);
+            makeShared<SimpleUnaryTrigger<Op, TriggerType>>(op);
         op->operand->addTrigger(newTrigger);
         op->operandTrigger = newTrigger;
     }
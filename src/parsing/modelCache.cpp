@@ -0,0 +1,71 @@
+#include "parsing/modelCache.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include "picosha2.h"
+using namespace std;
+
+ModelCache::ModelCache(string directory) : directory(move(directory)) {
+    if (mkdir(this->directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        myCerr << "Warning: could not create model cache directory "
+               << this->directory << ": " << strerror(errno) << endl;
+    }
+}
+
+string ModelCache::entryPath(const string& key) const {
+    return directory + "/" + key + ".cbor";
+}
+
+string ModelCache::key(const string& file, bool specFile) const {
+    ifstream is(file, ios::binary);
+    ostringstream contents;
+    contents << ((specFile) ? "spec\n" : "param\n") << is.rdbuf();
+    string input = contents.str();
+    return picosha2::hash256_hex_string(input.begin(), input.end());
+}
+
+lib::optional<nlohmann::json> ModelCache::load(const string& key) const {
+    ifstream is(entryPath(key), ios::binary);
+    if (!is.good()) {
+        return lib::nullopt;
+    }
+    vector<uint8_t> cbor((istreambuf_iterator<char>(is)),
+                         istreambuf_iterator<char>());
+    try {
+        return nlohmann::json::from_cbor(cbor);
+    } catch (nlohmann::detail::exception& e) {
+        myCerr << "Warning: ignoring unreadable model cache entry "
+               << entryPath(key) << ": " << e.what() << endl;
+        return lib::nullopt;
+    }
+}
+
+void ModelCache::save(const string& key, const nlohmann::json& json) const {
+    string path = entryPath(key);
+    string tempPath = path + "." + to_string(getpid()) + ".tmp";
+    vector<uint8_t> cbor = nlohmann::json::to_cbor(json);
+    {
+        ofstream os(tempPath, ios::binary);
+        os.write(reinterpret_cast<const char*>(cbor.data()), cbor.size());
+        if (!os.good()) {
+            myCerr << "Warning: could not write model cache entry " << tempPath
+                   << endl;
+            remove(tempPath.c_str());
+            return;
+        }
+    }
+    if (rename(tempPath.c_str(), path.c_str()) != 0) {
+        myCerr << "Warning: could not write model cache entry " << path
+               << ": " << strerror(errno) << endl;
+        remove(tempPath.c_str());
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef SRC_PARSING_MODELCACHE_H_
+#define SRC_PARSING_MODELCACHE_H_
+#include <json.hpp>
+#include <string>
+
+#include "base/base.h"
+
+// On disk cache of the JSON that conjure translates essence and param files
+// into (--model-cache), so that repeated runs on the same files neither run
+// conjure nor parse JSON text.  Each file is cached separately, named after the
+// SHA256 of its contents, and stored in CBOR, which is smaller and faster to
+// read than JSON text.  Entries are written to a temporary file and then
+// renamed, so concurrent runs sharing a cache never read a partial entry.
+class ModelCache {
+    std::string directory;
+
+    std::string entryPath(const std::string& key) const;
+
+   public:
+    ModelCache(std::string directory);
+    // the key of a file, computed from its contents.  Spec and param files
+    // are keyed apart, as conjure translates them differently.
+    std::string key(const std::string& file, bool specFile) const;
+    // the cached JSON of key, none if it is not cached or the entry could not
+    // be read
+    lib::optional<nlohmann::json> load(const std::string& key) const;
+    // failures are reported but otherwise ignored, the cache is only an
+    // optimisation
+    void save(const std::string& key, const nlohmann::json& json) const;
+};
+
+#endif /* SRC_PARSING_MODELCACHE_H_ */
@@ -40,7 +40,7 @@ class RandomWalk : public SearchStrategy {
                     if (!result.foundAssignment) {
                         return false;
                     }
-                    bool allowed = result.model.getViolation() <
+                    bool allowed = result.getViolation() <
                                    startViolation + allowedViolationBackOff;
                     numberIterations += allowed;
                     return allowed;
@@ -80,9 +80,9 @@ class ExplorationUsingViolationBackOff : public SearchStrategy {
                     if (!result.foundAssignment) {
                         return false;
                     }
-                    allowed = result.model.getViolation() <=
-                                  violationBackOff.getValue() &&
-                              result.model.getObjective() <= objToBeat;
+                    allowed =
+                        result.getViolation() <= violationBackOff.getValue() &&
+                        result.getObjective() <= objToBeat;
                     return allowed;
                 });
             if (!(state.model.getObjective() < objToBeat)) {
@@ -103,7 +103,7 @@ class ExplorationUsingViolationBackOff : public SearchStrategy {
                         return false;
                     }
                     allowed = result.getDeltaViolation() <= 0 &&
-                              result.model.getObjective() < objToBeat;
+                              result.getObjective() < objToBeat;
                     return allowed;
                 });
             if (!allowed) {
@@ -152,6 +152,7 @@ class ExplorationUsingViolationBackOff : public SearchStrategy {
                 increaseExploreSize();
                 numberIncreases += 1;
             } else {
+                state.importIncumbentIfBetter();
                 climbTo0Violation(state);
                 objToBeat = state.model.getObjective();
                 resetExploreSize();
@@ -202,6 +203,7 @@ class ExplorationUsingRandomWalk : public SearchStrategy {
                 increaseExploreSize();
                 numberIncreases += 1;
             } else {
+                state.importIncumbentIfBetter();
                 resetExploreSize();
                 vioToBeat = state.model.getViolation();
                 objToBeat = state.model.getObjective();
@@ -288,6 +290,7 @@ class ExplorationUsingAuto : public SearchStrategy,
                 rwExplorer.increaseExploreSize();
                 numberIncreases += 1;
             } else {
+                climbStrategy->notifyStagnation();
                 vbExplorer.resetExploreSize();
                 rwExplorer.resetExploreSize();
                 climbTo0Violation(state, rwExplorer);
@@ -1,8 +1,10 @@
 
 #ifndef SRC_SEARCH_IMPROVESTRATEGIES_H_
 #define SRC_SEARCH_IMPROVESTRATEGIES_H_
+#include <algorithm>
 #include <cmath>
 #include <deque>
+#include <limits>
 
 #include "search/model.h"
 #include "search/neighbourhoodSearchStrategies.h"
@@ -71,7 +73,7 @@ class HillClimbing : public SearchStrategy {
                             allowed = result.getDeltaViolation() <= 0;
                             strictImprovement = result.getDeltaViolation() < 0;
                         } else {
-                            allowed = result.model.getViolation() == 0 &&
+                            allowed = result.getViolation() == 0 &&
                                       result.objectiveBetterOrEqual();
                             strictImprovement =
                                 allowed && result.objectiveStrictlyBetter();
@@ -133,17 +135,15 @@ class LateAcceptanceHillClimbing : public SearchStrategy {
                     bool allowed = false;
                     if (result.foundAssignment) {
                         if (result.statsMarkPoint.lastViolation != 0) {
-                            allowed = result.model.getViolation() <=
-                                          vioHistory.front() ||
-                                      result.model.getViolation() <=
-                                          vioHistory.back();
-                        } else if (result.model.getViolation() == 0) {
+                            allowed =
+                                result.getViolation() <= vioHistory.front() ||
+                                result.getViolation() <= vioHistory.back();
+                        } else if (result.getViolation() == 0) {
                             // last violation was 0, current violation is 0,
                             // check objective:
-                            allowed = result.model.getObjective() <=
-                                          objHistory.front() ||
-                                      result.model.getObjective() <=
-                                          objHistory.back();
+                            allowed =
+                                result.getObjective() <= objHistory.front() ||
+                                result.getObjective() <= objHistory.back();
                         }
                     }
                     return allowed;
@@ -179,6 +179,427 @@ class LateAcceptanceHillClimbing : public SearchStrategy {
     }
 };
 
+// Simulated annealing.  A move that worsens the assignment by delta is accepted
+// with probability exp(-delta / temperature), where delta combines the change
+// in violation and the change in objective, see combinedDelta.  The first
+// CALIBRATION_ITERATIONS moves are accepted as by hill climbing and sampled to
+// calibrate the schedule:
+// - the weight of a unit of violation, large enough that the smallest
+//   worsening of the violation outweighs the largest worsening of the
+//   objective, so that the search still favours valid assignments;
+// - the initial temperature, at which an average worsening move is accepted
+//   with INITIAL_ACCEPTANCE probability;
+// - the final temperature, at which the smallest worsening move is accepted
+//   with FINAL_ACCEPTANCE probability.
+// The temperature cools geometrically from the first to the second over
+// coolingIterations.  It is reheated to the initial temperature when an
+// explore strategy reports stagnation, or, when annealing is the outer most
+// strategy, once it is cold and has not improved for the peak iterations.
+// When given a ReplicaExchange, annealing is a replica of a parallel tempering
+// search: it does not cool, but runs at the temperature of the rung of the
+// ladder that it holds.  Replica 0 calibrates the ladder, the other replicas
+// hill climb until it is published.
+class SimulatedAnnealing : public SearchStrategy {
+    std::shared_ptr<NeighbourhoodSelectionStrategy> selector;
+    std::shared_ptr<NeighbourhoodSearchStrategy> searcher;
+    const UInt64 allowedIterationsAtPeak = improveStratPeakIterations;
+    static constexpr UInt64 CALIBRATION_ITERATIONS = 2000;
+    static constexpr double INITIAL_ACCEPTANCE = 0.5;
+    static constexpr double FINAL_ACCEPTANCE = 0.005;
+    UInt64 coolingIterations;
+    // (delta violation, delta objective) of the worsening moves seen while
+    // calibrating
+    std::vector<std::pair<Int, Int>> calibrationSamples;
+    UInt64 calibrationIterations = 0;
+    bool calibrated = false;
+    double violationWeight = 1;
+    double initialTemperature = 0;
+    double finalTemperature = 0;
+    double coolingRate = 1;
+    double temperature = 0;
+    bool reheatPending = false;
+    UInt64 numberWorseningAccepted = 0;
+    UInt64 numberWorseningRejected = 0;
+    UInt64 numberReheats = 0;
+    ReplicaExchange* replicaExchange;
+    size_t replicaId;
+    UInt64 iterationsSinceExchange = 0;
+
+    inline double combinedDelta(Int deltaViolation, Int deltaObjective) const {
+        return violationWeight * deltaViolation + deltaObjective;
+    }
+
+    void calibrate() {
+        Int smallestViolationWorsening = std::numeric_limits<Int>::max();
+        Int largestObjectiveWorsening = 0;
+        for (auto& sample : calibrationSamples) {
+            if (sample.first > 0) {
+                smallestViolationWorsening =
+                    std::min(smallestViolationWorsening, sample.first);
+            }
+            largestObjectiveWorsening =
+                std::max(largestObjectiveWorsening, sample.second);
+        }
+        if (smallestViolationWorsening != std::numeric_limits<Int>::max()) {
+            violationWeight =
+                std::max(1.0, (double)(largestObjectiveWorsening + 1) /
+                                  smallestViolationWorsening);
+        }
+        double worseningSum = 0;
+        double smallestWorsening = std::numeric_limits<double>::max();
+        UInt64 worseningCount = 0;
+        for (auto& sample : calibrationSamples) {
+            double delta = combinedDelta(sample.first, sample.second);
+            if (delta > 0) {
+                worseningSum += delta;
+                smallestWorsening = std::min(smallestWorsening, delta);
+                ++worseningCount;
+            }
+        }
+        if (worseningCount == 0) {
+            worseningSum = smallestWorsening = worseningCount = 1;
+        }
+        initialTemperature =
+            -(worseningSum / worseningCount) / std::log(INITIAL_ACCEPTANCE);
+        finalTemperature = -smallestWorsening / std::log(FINAL_ACCEPTANCE);
+        coolingRate =
+            std::pow(finalTemperature / initialTemperature,
+                     1.0 / std::max<UInt64>(coolingIterations, 1));
+        temperature = initialTemperature;
+        calibrationSamples.clear();
+        calibrationSamples.shrink_to_fit();
+        calibrated = true;
+    }
+
+    void reheat() {
+        temperature = initialTemperature;
+        reheatPending = false;
+        ++numberReheats;
+    }
+
+    void updateCalibration() {
+        if (replicaId != 0) {
+            if (replicaExchange->ladderReady()) {
+                violationWeight = replicaExchange->getViolationWeight();
+                temperature = replicaExchange->getTemperature(replicaId);
+                calibrated = true;
+            }
+        } else if (++calibrationIterations == CALIBRATION_ITERATIONS) {
+            calibrate();
+            if (replicaExchange) {
+                replicaExchange->publishLadder(
+                    violationWeight, finalTemperature, initialTemperature);
+                temperature = replicaExchange->getTemperature(replicaId);
+            }
+        }
+    }
+
+    void updateReplica(State& state) {
+        double energy = violationWeight * state.model.getViolation();
+        if (state.model.objectiveDefined()) {
+            energy += state.model.getObjective().minimisedValue();
+        }
+        replicaExchange->publishEnergy(replicaId, energy);
+        if (replicaId == 0 &&
+            ++iterationsSinceExchange == replicaExchange->exchangeInterval) {
+            replicaExchange->proposeSwaps();
+            iterationsSinceExchange = 0;
+        }
+        temperature = replicaExchange->getTemperature(replicaId);
+    }
+
+    template <typename Result>
+    bool accept(const Result& result) {
+        if (!result.foundAssignment) {
+            return false;
+        }
+        Int deltaViolation = result.getDeltaViolation();
+        Int deltaObjective = 0;
+        const Objective& lastObjective = result.statsMarkPoint.lastObjective;
+        Objective objective = result.getObjective();
+        if (lastObjective.isDefined() && objective.isDefined()) {
+            deltaObjective = objective.worseBy(lastObjective);
+        } else if (lastObjective.isDefined() && result.getViolation() == 0) {
+            // a valid assignment must have a defined objective
+            return false;
+        }
+        if (!calibrated) {
+            if ((deltaViolation > 0 || deltaObjective > 0) && replicaId == 0) {
+                calibrationSamples.emplace_back(deltaViolation, deltaObjective);
+            }
+            if (result.statsMarkPoint.lastViolation != 0) {
+                return deltaViolation <= 0;
+            }
+            return deltaViolation == 0 && deltaObjective <= 0;
+        }
+        double delta = combinedDelta(deltaViolation, deltaObjective);
+        if (delta <= 0) {
+            return true;
+        }
+        bool allowed =
+            globalRandom<double>(0, 1) < std::exp(-delta / temperature);
+        numberWorseningAccepted += allowed;
+        numberWorseningRejected += !allowed;
+        return allowed;
+    }
+
+   public:
+    SimulatedAnnealing(std::shared_ptr<NeighbourhoodSelectionStrategy> selector,
+                       std::shared_ptr<NeighbourhoodSearchStrategy> searcher,
+                       UInt64 coolingIterations,
+                       ReplicaExchange* replicaExchange = nullptr,
+                       size_t replicaId = 0)
+        : selector(std::move(selector)),
+          searcher(std::move(searcher)),
+          coolingIterations(coolingIterations),
+          replicaExchange(replicaExchange),
+          replicaId(replicaId) {}
+
+    void run(State& state, bool isOuterMostStrategy) {
+        if (reheatPending) {
+            reheat();
+        }
+        UInt64 iterationsAtPeak = 0;
+        Objective bestObjective = state.model.getObjective();
+        UInt bestViolation = state.model.getViolation();
+        while (true) {
+            bool wasViolating = state.model.getViolation() > 0;
+            SearchMode searchMode =
+                (wasViolating) ? SearchMode::LOOKING_FOR_VIO_IMPROVEMENT
+                               : SearchMode::LOOKING_FOR_VALID_OBJ_IMPROVEMENT;
+            searcher->search(
+                state, selector->nextNeighbourhood(state, searchMode),
+                [&](const auto& result) { return this->accept(result); });
+            if (!calibrated) {
+                updateCalibration();
+            } else if (replicaExchange) {
+                updateReplica(state);
+            } else {
+                temperature =
+                    std::max(finalTemperature, temperature * coolingRate);
+            }
+            bool isViolating = state.model.getViolation() > 0;
+            bool improvesOnBest =
+                (isViolating)
+                    ? state.model.getViolation() < bestViolation
+                    : bestViolation > 0 ||
+                          state.model.getObjective() < bestObjective;
+            if (improvesOnBest) {
+                bestViolation = state.model.getViolation();
+                bestObjective = state.model.getObjective();
+                iterationsAtPeak = 0;
+            } else {
+                ++iterationsAtPeak;
+                if (iterationsAtPeak > allowedIterationsAtPeak) {
+                    if (!isOuterMostStrategy) {
+                        break;
+                    }
+                    if (calibrated && !replicaExchange &&
+                        temperature <= finalTemperature) {
+                        reheat();
+                        iterationsAtPeak = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    inline void notifyStagnation() final { reheatPending = calibrated; }
+
+    // the fraction of the worsening moves tried since calibration that were
+    // accepted
+    inline double worseningAcceptanceRate() const {
+        UInt64 total = numberWorseningAccepted + numberWorseningRejected;
+        return (total == 0) ? 0 : (double)numberWorseningAccepted / total;
+    }
+
+    inline void printAdditionalStats(std::ostream& os) final {
+        os << "violation weight," << violationWeight << "\n";
+        os << "initial temperature," << initialTemperature << "\n";
+        os << "final temperature," << finalTemperature << "\n";
+        os << "temperature," << temperature << "\n";
+        os << "worsening moves accepted," << numberWorseningAccepted << "\n";
+        os << "worsening moves rejected," << numberWorseningRejected << "\n";
+        os << "reheats," << numberReheats << "\n";
+    }
+};
+
+// Accepts moves that are no worse than the current assignment, like hill
+// climbing, but a var may not return to a value it held in the last tenure
+// iterations.  Values are compared by getValueHash, so for sets and the like
+// the hash covers the members.  A tabu move is still accepted if it improves
+// on the best assignment found in this run (aspiration).  The tenure grows
+// from minTenure to MAX_TENURE_MULTIPLIER * minTenure as iterationsAtPeak
+// approaches the peak iterations, so the longer the search stalls on a
+// plateau, the further it is pushed from the values it has visited.
+class TabuSearch : public SearchStrategy {
+    std::shared_ptr<NeighbourhoodSelectionStrategy> selector;
+    std::shared_ptr<NeighbourhoodSearchStrategy> searcher;
+    const UInt64 allowedIterationsAtPeak = improveStratPeakIterations;
+    static const UInt64 MAX_TENURE_MULTIPLIER = 10;
+    UInt64 minTenure;
+    // hash of the current value of each var
+    std::vector<HashType> varHashes;
+    // iteration at which each (var, value) pair became tabu, see tabuKey
+    HashMap<HashType, UInt64> tabuSince;
+    // the same pairs in the order they became tabu, so that expired pairs can
+    // be removed
+    std::deque<std::pair<HashType, UInt64>> tabuQueue;
+    std::vector<UInt> changedVars;
+    UInt64 numberTabuRejections = 0;
+    UInt64 numberAspirations = 0;
+
+    // the hash of the value of var, or of the value it would have after the
+    // move being peeked at, see base/peek.h.  Only int and bool vars are
+    // peeked at.
+    static HashType peekedValueHash(const AnyValRef& var) {
+        return lib::visit(
+            overloaded(
+                [&](const ValRef<IntValue>& val) {
+                    const IntView& view = *val;
+                    return getIntValueHash(
+                        peekContext.valueOf(&view, view.value));
+                },
+                [&](const ValRef<BoolValue>& val) {
+                    const BoolView& view = *val;
+                    return HashType(
+                        peekContext.valueOf(&view, view.violation) == 0);
+                },
+                [&](const auto& val) { return getValueHash(val); }),
+            var);
+    }
+    static inline HashType tabuKey(UInt var, HashType valueHash) {
+        return mix(HashType(var) + valueHash);
+    }
+    inline bool isTabu(UInt var, HashType valueHash, UInt64 iteration,
+                       UInt64 tenure) const {
+        auto iter = tabuSince.find(tabuKey(var, valueHash));
+        return iter != tabuSince.end() && iteration - iter->second < tenure;
+    }
+    inline UInt64 getTenure(UInt64 iterationsAtPeak) const {
+        UInt64 stall = std::min(iterationsAtPeak, allowedIterationsAtPeak);
+        return minTenure + (MAX_TENURE_MULTIPLIER - 1) * minTenure * stall /
+                               std::max<UInt64>(allowedIterationsAtPeak, 1);
+    }
+    void makeTabu(HashType key, UInt64 iteration) {
+        tabuSince[key] = iteration;
+        tabuQueue.emplace_back(key, iteration);
+        while (iteration - tabuQueue.front().second >=
+               MAX_TENURE_MULTIPLIER * minTenure) {
+            auto iter = tabuSince.find(tabuQueue.front().first);
+            if (iter->second == tabuQueue.front().second) {
+                tabuSince.erase(iter);
+            }
+            tabuQueue.pop_front();
+        }
+    }
+
+   public:
+    TabuSearch(std::shared_ptr<NeighbourhoodSelectionStrategy> selector,
+               std::shared_ptr<NeighbourhoodSearchStrategy> searcher,
+               UInt64 minTenure)
+        : selector(std::move(selector)),
+          searcher(std::move(searcher)),
+          minTenure(std::max<UInt64>(minTenure, 1)) {}
+
+    void run(State& state, bool isOuterMostStrategy) {
+        auto& variables = state.model.variables;
+        // vars may have been changed by other strategies since the last run
+        varHashes.resize(variables.size());
+        for (size_t i = 0; i < variables.size(); i++) {
+            if (valBase(variables[i].second).container != &inlinedPool) {
+                varHashes[i] = getValueHash(variables[i].second);
+            }
+        }
+        tabuSince.clear();
+        tabuQueue.clear();
+        UInt64 iteration = 0, iterationsAtPeak = 0;
+        Objective bestObjective = state.model.getObjective();
+        UInt bestViolation = state.model.getViolation();
+        while (true) {
+            ++iteration;
+            UInt64 tenure = getTenure(iterationsAtPeak);
+            bool wasViolating = state.model.getViolation() > 0;
+            SearchMode searchMode =
+                (wasViolating) ? SearchMode::LOOKING_FOR_VIO_IMPROVEMENT
+                               : SearchMode::LOOKING_FOR_VALID_OBJ_IMPROVEMENT;
+            changedVars.clear();
+            searcher->search(
+                state, selector->nextNeighbourhood(state, searchMode),
+                [&](const auto& result) {
+                    if (!result.foundAssignment) {
+                        return false;
+                    }
+                    bool allowed = false, aspiration = false;
+                    if (result.statsMarkPoint.lastViolation != 0) {
+                        allowed = result.getDeltaViolation() <= 0;
+                        aspiration = result.getViolation() < bestViolation;
+                    } else if (result.getViolation() == 0) {
+                        allowed = result.objectiveBetterOrEqual();
+                        aspiration = result.getObjective() < bestObjective;
+                    }
+                    if (!allowed) {
+                        return false;
+                    }
+                    changedVars.insert(changedVars.end(),
+                                       result.varIndices.begin(),
+                                       result.varIndices.end());
+                    auto tabu = [&](UInt var) {
+                        HashType hash =
+                            (result.peeked)
+                                ? peekedValueHash(variables[var].second)
+                                : getValueHash(variables[var].second);
+                        return hash != varHashes[var] &&
+                               isTabu(var, hash, iteration, tenure);
+                    };
+                    // forwardedVarIds lists the vars assigned by defined
+                    // expressions, none if the move is peeked at
+                    if (std::any_of(result.varIndices.begin(),
+                                    result.varIndices.end(), tabu) ||
+                        std::any_of(forwardedVarIds.begin(),
+                                    forwardedVarIds.end(), tabu)) {
+                        numberAspirations += aspiration;
+                        numberTabuRejections += !aspiration;
+                        return aspiration;
+                    }
+                    return true;
+                });
+            // the values left by the applied moves become tabu
+            changedVars.insert(changedVars.end(), forwardedVarIds.begin(),
+                               forwardedVarIds.end());
+            for (UInt var : changedVars) {
+                HashType hash = getValueHash(variables[var].second);
+                if (hash != varHashes[var]) {
+                    makeTabu(tabuKey(var, varHashes[var]), iteration);
+                    varHashes[var] = hash;
+                }
+            }
+            bool isViolating = state.model.getViolation() > 0;
+            bool improvesOnBest =
+                (isViolating)
+                    ? state.model.getViolation() < bestViolation
+                    : bestViolation > 0 ||
+                          state.model.getObjective() < bestObjective;
+            if (improvesOnBest) {
+                bestViolation = state.model.getViolation();
+                bestObjective = state.model.getObjective();
+                iterationsAtPeak = 0;
+            } else {
+                ++iterationsAtPeak;
+                if (!isOuterMostStrategy &&
+                    iterationsAtPeak > allowedIterationsAtPeak) {
+                    break;
+                }
+            }
+        }
+    }
+
+    inline void printAdditionalStats(std::ostream& os) final {
+        os << "tabu rejections," << numberTabuRejections << "\n";
+        os << "aspirations," << numberAspirations << "\n";
+    }
+};
+
 class HillClimbingWithViolations : public SearchStrategy {
     std::shared_ptr<NeighbourhoodSelectionStrategy> selector;
     std::shared_ptr<NeighbourhoodSearchStrategy> searcher;
@@ -224,9 +645,9 @@ class HillClimbingWithViolations : public SearchStrategy {
                     if (!result.foundAssignment) {
                         return false;
                     }
-                    allowed = result.model.getViolation() <=
-                                  violationBackOff.getValue() &&
-                              result.model.getObjective() <= objToBeat;
+                    allowed =
+                        result.getViolation() <= violationBackOff.getValue() &&
+                        result.getObjective() <= objToBeat;
                     return allowed;
                 });
             if (!(state.model.getObjective() < objToBeat)) {
@@ -253,7 +674,7 @@ class HillClimbingWithViolations : public SearchStrategy {
                         return false;
                     }
                     allowed = result.getDeltaViolation() <= 0 &&
-                              result.model.getObjective() < objToBeat;
+                              result.getObjective() < objToBeat;
                     return allowed;
                 });
             if (!allowed) {
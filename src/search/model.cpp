@@ -1,7 +1,10 @@
 #include "search/model.h"
 
+#include <algorithm>
 #include <iostream>
+#include <unordered_map>
 
+#include "operators/quantifier.h"
 #include "search/endOfSearchException.h"
 #include "search/statsContainer.h"
 #ifdef WASM_TARGET
@@ -10,6 +13,95 @@
 extern bool noPrintSolutions;
 extern bool shouldRunHashChecks;
 using namespace std;
+namespace {
+template <typename View>
+void addIfVariable(ExprRef<View>& expr, vector<UInt>& varIds) {
+    typedef typename AssociatedValueType<View>::type Value;
+    auto* value = dynamic_cast<Value*>(&(*expr));
+    if (value && value->container == &variablePool) {
+        varIds.emplace_back(value->id);
+    }
+}
+
+// findAndReplace does not descend into the container of a quantifier
+template <typename View>
+void visitQuantifierContainer(ExprRef<View>&, const FindAndReplaceFunction&) {}
+
+template <typename ContainerType>
+bool visitContainerIf(ExprRef<SequenceView>& expr,
+                      const FindAndReplaceFunction& func) {
+    auto* quantifier = dynamic_cast<Quantifier<ContainerType>*>(&(*expr));
+    if (quantifier) {
+        findAndReplace(quantifier->container, func);
+    }
+    return quantifier;
+}
+
+void visitQuantifierContainer(ExprRef<SequenceView>& expr,
+                              const FindAndReplaceFunction& func) {
+    visitContainerIf<SetView>(expr, func) ||
+        visitContainerIf<MSetView>(expr, func) ||
+        visitContainerIf<SequenceView>(expr, func) ||
+        visitContainerIf<FunctionView>(expr, func);
+}
+
+// ids of the variables that expr refers to, may contain duplicates
+vector<UInt> findReferencedVars(ExprRef<BoolView>& expr) {
+    vector<UInt> varIds;
+    FindAndReplaceFunction func;
+    func = [&](AnyExprRef ref, const PathExtension&) {
+        lib::visit(
+            [&](auto& expr) {
+                addIfVariable(expr, varIds);
+                visitQuantifierContainer(expr, func);
+            },
+            ref);
+        return make_pair(false, ref);
+    };
+    findAndReplace(expr, func);
+    return varIds;
+}
+}  // namespace
+
+ExprRefVec<BoolView>* Model::getTopLevelConstraints() {
+    auto opAndTest = getAs<OpAnd>(csp);
+    if (!opAndTest) {
+        return nullptr;
+    }
+    auto sequenceLitTest = getAs<OpSequenceLit>(opAndTest->operand);
+    if (!sequenceLitTest) {
+        return nullptr;
+    }
+    return lib::get_if<ExprRefVec<BoolView>>(&sequenceLitTest->members);
+}
+
+vector<bool> Model::varsWithNeighbourhoods() const {
+    vector<bool> hasNeighbourhoods;
+    for (auto& neighbourhoods : varNeighbourhoodMapping) {
+        hasNeighbourhoods.push_back(!neighbourhoods.empty());
+    }
+    return hasNeighbourhoods;
+}
+
+void ModelBuilder::createVarConstraintMapping() {
+    auto constraints = model.getTopLevelConstraints();
+    if (!constraints) {
+        return;
+    }
+    model.varConstraintMapping.resize(model.variables.size());
+    for (size_t i = 0; i < constraints->size(); i++) {
+        auto varIds = findReferencedVars((*constraints)[i]);
+        sort(varIds.begin(), varIds.end());
+        varIds.erase(unique(varIds.begin(), varIds.end()), varIds.end());
+        for (UInt varId : varIds) {
+            if (varId >= model.varConstraintMapping.size()) {
+                model.varConstraintMapping.resize(varId + 1);
+            }
+            model.varConstraintMapping[varId].emplace_back(i);
+        }
+    }
+}
+
 void ModelBuilder::createNeighbourhoods() {
     for (size_t i = 0; i < model.variables.size(); ++i) {
         if (valBase(model.variables[i].second).container == &inlinedPool) {
@@ -33,11 +125,66 @@ void ModelBuilder::createNeighbourhoods() {
             iter->name = model.variableNames[i] + "_" + iter->name;
         }
     }
+    model.neighbourhoodGroupMapping.assign(model.neighbourhoods.size(), -1);
+    createMultiVarNeighbourhoods();
     if (model.neighbourhoods.empty()) {
         cout << "Could not create any neighbourhoods\n";
     }
 }
 
+// vars are grouped by the printed form of their domain, which is the same
+// for identical domains
+void ModelBuilder::createMultiVarNeighbourhoods() {
+    unordered_map<string, size_t> groupIndices;
+    vector<vector<int>> groups;
+    model.varGroupMapping.assign(model.variables.size(), -1);
+    model.varGroupPositions.assign(model.variables.size(), 0);
+    for (size_t i = 0; i < model.variables.size(); ++i) {
+        if (valBase(model.variables[i].second).container == &inlinedPool) {
+            continue;
+        }
+        auto inserted = groupIndices.emplace(
+            toString(model.variables[i].first), groups.size());
+        if (inserted.second) {
+            groups.emplace_back();
+        }
+        groups[inserted.first->second].emplace_back(i);
+    }
+    for (auto& group : groups) {
+        if (group.size() < 2) {
+            continue;
+        }
+        vector<Neighbourhood> neighbourhoods;
+        generateNeighbourhoods(group.size(), model.variables[group[0]].first,
+                               neighbourhoods);
+        string groupName = model.variableNames[group.front()] + ".." +
+                           model.variableNames[group.back()];
+        bool hasNeighbourhoods = false;
+        for (auto& nh : neighbourhoods) {
+            if (nh.numberValsRequired < 2) {
+                continue;
+            }
+            hasNeighbourhoods = true;
+            for (int var : group) {
+                model.varNeighbourhoodMapping[var].emplace_back(
+                    model.neighbourhoods.size());
+            }
+            model.neighbourhoodVarMapping.emplace_back(group.front());
+            model.neighbourhoodGroupMapping.emplace_back(
+                model.varGroups.size());
+            nh.name = groupName + "_" + nh.name;
+            model.neighbourhoods.emplace_back(move(nh));
+        }
+        if (hasNeighbourhoods) {
+            for (size_t i = 0; i < group.size(); i++) {
+                model.varGroupMapping[group[i]] = model.varGroups.size();
+                model.varGroupPositions[group[i]] = i;
+            }
+            model.varGroups.emplace_back(move(group));
+        }
+    }
+}
+
 void ModelBuilder::createRandomReassignNeighbourhoods() {
     for (size_t i = 0; i < model.variables.size(); ++i) {
         auto& domain = model.variables[i].first;
@@ -112,6 +259,7 @@ Model ModelBuilder::build() {
     model.csp =
         make_shared<OpAnd>(make_shared<OpSequenceLit>(move(constraints)));
     optimiseExpr(model.csp);
+    createVarConstraintMapping();
     createNeighbourhoods();
     createRandomReassignNeighbourhoods();
 
@@ -301,6 +449,20 @@ Objective Model::getObjective() const {
                       objective);
 }
 
+Objective Model::getPeekedObjective() const {
+    auto intObjective = lib::get_if<ExprRef<IntView>>(&objective);
+    if (!intObjective) {
+        // the members of tuple objectives can not be peeked, so the objective
+        // is unchanged
+        return getObjective();
+    }
+    auto view = (*intObjective)->getViewIfDefined();
+    if (!view) {
+        return Objective::Undefined();
+    }
+    return Objective(optimiseMode, peekValue(*view));
+}
+
 bool Model::objectiveDefined() const {
     return lib::visit(
         [&](const auto& objective) {
@@ -26,8 +26,24 @@ struct Model {
     std::vector<std::string> variableNames;
     std::vector<Neighbourhood> neighbourhoods;
     std::vector<Neighbourhood> randomReassignNeighbourhoods;
+    // the var of each neighbourhood, for neighbourhoods requiring several
+    // vars the first var of their group
     std::vector<int> neighbourhoodVarMapping;
     std::vector<std::vector<int>> varNeighbourhoodMapping;
+    // groups of two or more vars with identical domains.  The neighbourhoods
+    // requiring several vars are generated once per group, the vars they
+    // change are drawn from the group when they are run.
+    std::vector<std::vector<int>> varGroups;
+    // the index in varGroups of the group of each neighbourhood requiring
+    // several vars, -1 for the other neighbourhoods
+    std::vector<int> neighbourhoodGroupMapping;
+    // the index in varGroups of the group of each var, -1 if not grouped
+    std::vector<int> varGroupMapping;
+    // the position of each grouped var within its group
+    std::vector<UInt> varGroupPositions;
+    // indices of the top level constraints (see getTopLevelConstraints) that
+    // refer to each variable, empty if they do not form a fixed list
+    std::vector<std::vector<UInt>> varConstraintMapping;
     ExprRef<BoolView> csp = nullptr;
     AnyExprRef objective = make<IntValue>().asExpr();
     OptimiseMode optimiseMode = OptimiseMode::NONE;
@@ -44,8 +60,18 @@ struct Model {
 
    public:
     inline UInt getViolation() const { return csp->view()->violation; }
+    // the operands of csp, null if they do not form a fixed list
+    ExprRefVec<BoolView>* getTopLevelConstraints();
+    // true for each variable that owns at least one neighbourhood
+    std::vector<bool> varsWithNeighbourhoods() const;
     Objective getObjective() const;
     bool objectiveDefined() const;
+    // the violation and objective after the move being peeked at, see
+    // base/peek.h
+    inline UInt getPeekedViolation() const {
+        return peekViolation(*csp->view());
+    }
+    Objective getPeekedObjective() const;
 };
 
 class ModelBuilder {
@@ -58,7 +84,9 @@ class ModelBuilder {
     std::vector<AnyValRef> varsToBeDefined;
 
     void createNeighbourhoods();
+    void createMultiVarNeighbourhoods();
     void createRandomReassignNeighbourhoods();
+    void createVarConstraintMapping();
     void substituteVarsToBeDefined();
     FindAndReplaceFunction makeFindReplaceFunc(AnyValRef& var,
                                                AnyExprRef& expr);
@@ -3,6 +3,7 @@
 #define SRC_SEARCH_NEIGHBOURHOODSEARCHSTRATEGIES_H_
 #include "search/solver.h"
 #include "search/statsContainer.h"
+#include "utils/random.h"
 class NeighbourhoodSearchStrategy {
    public:
     typedef std::function<bool(const NeighbourhoodResult&)> Callback;
@@ -30,7 +31,7 @@ class FirstAtLeastEqual : public NeighbourhoodSearchStrategy {
             state.runNeighbourhood(neighbourhood, [&](const auto& result) {
                 bool atLeastAsGood = (result.statsMarkPoint.lastViolation != 0)
                                          ? result.getDeltaViolation() <= 0
-                                         : result.model.getViolation() == 0 &&
+                                         : result.getViolation() == 0 &&
                                                result.objectiveBetterOrEqual();
                 if (atLeastAsGood || attempts == maxNumberAttempts) {
                     return callback(result);
@@ -41,4 +42,92 @@ class FirstAtLeastEqual : public NeighbourhoodSearchStrategy {
     }
 };
 
+// Samples numberSamples moves from the neighbourhood through
+// State::sampleNeighbourhood, recording the violation and objective each would
+// give, then commits only the best of them.  Samples are peeked at where
+// possible, otherwise applied and undone by the neighbourhood itself, and are
+// not counted as iterations: each call to search is a single iteration.  Moves
+// can not be stored, so the best move is regenerated by restoring the random
+// number generator to the state it had before that sample was drawn and
+// rejecting the assignments the neighbourhood found before it.  A
+// neighbourhood that adapts its own choices from the results of earlier
+// attempts may regenerate a different move.  The regenerated move is only
+// handed to the callback if its violation and objective match the best
+// sample, otherwise it is rejected and the neighbourhood is run once as usual,
+// as it is if no sample found an assignment.
+class BestOfK : public NeighbourhoodSearchStrategy {
+    size_t numberSamples;
+
+    static bool betterThan(const NeighbourhoodResult& result, UInt violation,
+                           const Objective& objective) {
+        UInt resultViolation = result.getViolation();
+        return resultViolation < violation ||
+               (resultViolation == violation &&
+                result.getObjective() < objective);
+    }
+
+    static bool matches(const NeighbourhoodResult& result, UInt violation,
+                        const Objective& objective) {
+        Objective resultObjective = result.getObjective();
+        bool objectiveMatches =
+            (objective.isDefined())
+                ? resultObjective.isDefined() && resultObjective == objective
+                : !resultObjective.isDefined();
+        return result.getViolation() == violation && objectiveMatches;
+    }
+
+   public:
+    BestOfK(size_t numberSamples) : numberSamples(numberSamples) {}
+    void search(State& state, size_t neighbourhood, Callback callback) {
+        bool foundAssignment = false;
+        UInt bestViolation = 0;
+        Objective bestObjective = Objective::Undefined();
+        RandomGenerator bestRandomState;
+        // number of assignments found in the best sample before the best one
+        size_t bestAttempt = 0;
+        for (size_t sample = 0; sample < numberSamples; ++sample) {
+            RandomGenerator randomState = globalRandomGenerator;
+            size_t attempt = 0;
+            state.sampleNeighbourhood(neighbourhood, [&](const auto& result) {
+                if (!foundAssignment ||
+                    betterThan(result, bestViolation, bestObjective)) {
+                    foundAssignment = true;
+                    bestViolation = result.getViolation();
+                    bestObjective = result.getObjective();
+                    bestRandomState = randomState;
+                    bestAttempt = attempt;
+                }
+                ++attempt;
+            });
+        }
+        if (!foundAssignment) {
+            state.runNeighbourhood(neighbourhood, callback);
+            return;
+        }
+        // continue from where sampling left off rather than repeating the
+        // random choices made after the best sample
+        RandomGenerator randomState = globalRandomGenerator;
+        globalRandomGenerator = bestRandomState;
+        size_t attempt = 0;
+        bool regenerated = false;
+        state.runNeighbourhood(neighbourhood, [&](const auto& result) {
+            if (!result.foundAssignment) {
+                return false;
+            }
+            size_t thisAttempt = attempt++;
+            if (thisAttempt < bestAttempt) {
+                return false;
+            }
+            if (thisAttempt == bestAttempt) {
+                regenerated = matches(result, bestViolation, bestObjective);
+            }
+            return regenerated && callback(result);
+        });
+        globalRandomGenerator = randomState;
+        if (!regenerated) {
+            state.runNeighbourhood(neighbourhood, callback);
+        }
+    }
+};
+
 #endif /* SRC_SEARCH_NEIGHBOURHOODSEARCHSTRATEGIES_H_ */
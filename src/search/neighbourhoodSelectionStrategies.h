@@ -20,13 +20,12 @@ enum class SearchMode {
 
 class NeighbourhoodSelectionStrategy {
    public:
-    virtual size_t nextNeighbourhood(const State& state,
-                                     SearchMode searchMode) = 0;
+    virtual size_t nextNeighbourhood(State& state, SearchMode searchMode) = 0;
     virtual ~NeighbourhoodSelectionStrategy() {}
 };
 class InteractiveNeighbourhoodSelector : public NeighbourhoodSelectionStrategy {
    public:
-    inline size_t nextNeighbourhood(const State& state, SearchMode) {
+    inline size_t nextNeighbourhood(State& state, SearchMode) {
         while (true) {
             std::cout << "select a neighbourhood, choices are:\n";
             for (size_t i = 0; i < state.model.neighbourhoods.size(); i++) {
@@ -55,25 +54,26 @@ class InteractiveNeighbourhoodSelector : public NeighbourhoodSelectionStrategy {
 
 class RandomNeighbourhood : public NeighbourhoodSelectionStrategy {
    public:
-    inline size_t nextNeighbourhood(const State& state, SearchMode) {
-        if (state.vioContainer.getTotalViolation() == 0) {
+    inline size_t nextNeighbourhood(State& state, SearchMode) {
+        // vars are only drawn if at least one of them owns neighbourhoods
+        if (state.vioContainer.getTotalViolation() == 0 ||
+            !state.vioContainer.hasSelectableVar(
+                state.model.variables.size() - 1)) {
             return globalRandom<size_t>(0,
                                         state.model.neighbourhoods.size() - 1);
         } else {
-            size_t biasRandomVar;
-            while (true) {
-                biasRandomVar = state.vioContainer.selectRandomVar(
-                    state.model.variables.size() - 1);
-                if (!state.model.varNeighbourhoodMapping[biasRandomVar]
-                         .empty()) {
-                    break;
-                }
-            }
-            return state.model
-                .varNeighbourhoodMapping[biasRandomVar][globalRandom<size_t>(
-                    0,
-                    state.model.varNeighbourhoodMapping[biasRandomVar].size() -
-                        1)];
+            // only vars owning neighbourhoods are drawn, see State, with
+            // probability proportional to their violation, that is to the
+            // violation of the constraints they appear in.  The var is kept if
+            // the neighbourhood requires several vars.
+            size_t biasRandomVar = state.vioContainer.selectRandomVar(
+                state.model.variables.size() - 1);
+            state.selectedVar = biasRandomVar;
+            auto& neighbourhoods =
+                state.model.varNeighbourhoodMapping[biasRandomVar];
+            debug_code(assert(!neighbourhoods.empty()));
+            return neighbourhoods[globalRandom<size_t>(
+                0, neighbourhoods.size() - 1)];
         }
     }
 };
@@ -161,7 +161,7 @@ class UcbNeighbourhoodSelector : public UcbSelector<UcbNeighbourhoodSelector>,
         return state.stats.neighbourhoodStats.size();
     }
 
-    inline size_t nextNeighbourhood(const State&, SearchMode searchMode) {
+    inline size_t nextNeighbourhood(State&, SearchMode searchMode) {
         this->searchMode = searchMode;
         return next();
     }
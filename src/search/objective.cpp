@@ -93,6 +93,40 @@ bool Objective::operator<=(const Objective& other) const {
         value);
 }
 
+Int Objective::worseBy(const Objective& other) const {
+    debug_code(assert(mode == other.mode));
+    debug_code(assert(isDefined() && other.isDefined()));
+    Int difference = lib::visit(
+        overloaded([&](const Objective::Undefined&) -> Int { return 0; },
+                   [&](Int value) -> Int {
+                       return value - lib::get<Int>(other.value);
+                   },
+                   [&](const auto& value) -> Int {
+                       const auto& otherValue =
+                           lib::get<BaseType<decltype(value)>>(other.value);
+                       for (size_t i = 0; i < value.size(); i++) {
+                           if (value[i] != otherValue[i]) {
+                               return value[i] - otherValue[i];
+                           }
+                       }
+                       return 0;
+                   }),
+        value);
+    return (mode == OptimiseMode::MAXIMISE) ? -difference : difference;
+}
+
+Int Objective::minimisedValue() const {
+    debug_code(assert(isDefined()));
+    Int minimised = lib::visit(
+        overloaded([&](const Objective::Undefined&) -> Int { return 0; },
+                   [&](Int value) -> Int { return value; },
+                   [&](const auto& value) -> Int {
+                       return (value.empty()) ? 0 : value.front();
+                   }),
+        value);
+    return (mode == OptimiseMode::MAXIMISE) ? -minimised : minimised;
+}
+
 bool Objective::operator==(const Objective& other) const {
     debug_code(assert(mode == other.mode));
     return lib::visit(
@@ -24,12 +24,20 @@ class Objective {
 
    public:
     Objective(Undefined) : mode(OptimiseMode::NONE), value(Undefined()) {}
+    Objective(OptimiseMode mode, Int value) : mode(mode), value(value) {}
     Objective(OptimiseMode mode, const ExprRef<IntView>& exprValue);
     Objective(OptimiseMode mode, const ExprRef<TupleView>& exprValue);
 
     bool operator==(const Objective& other) const;
     bool operator<(const Objective& other) const;
     bool operator<=(const Objective& other) const;
+    // how much worse this objective is than other, negative if better.  For
+    // tuple objectives, the difference of the first members that differ.
+    // Both objectives must be defined.
+    Int worseBy(const Objective& other) const;
+    // the objective as a single value to be minimised, negated when
+    // maximising.  For tuple objectives, the first member.  Must be defined.
+    Int minimisedValue() const;
     inline bool isDefined() const {
         return lib::get_if<Undefined>(&value) == NULL;
     }
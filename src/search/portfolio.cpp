@@ -0,0 +1,74 @@
+#include "search/portfolio.h"
+
+#include <cmath>
+
+#include "search/model.h"
+#include "utils/random.h"
+using namespace std;
+
+Portfolio* activePortfolio = nullptr;
+thread_local size_t portfolioWorkerId = 0;
+
+void Portfolio::publishIncumbent(size_t workerId, const Model& model) {
+    auto solution = make_shared<IncumbentSolution>(workerId, bestViolation,
+                                                   bestObjective);
+    solution->values.reserve(model.variables.size());
+    for (auto& var : model.variables) {
+        solution->values.emplace_back(deepCopy(var.second));
+    }
+    atomic_store(&incumbent,
+                 static_pointer_cast<const IncumbentSolution>(solution));
+}
+
+ReplicaExchange::ReplicaExchange(size_t numberReplicas,
+                                 UInt64 exchangeInterval)
+    : _ladderReady(false),
+      energies(numberReplicas),
+      rungs(numberReplicas),
+      replicaAtRung(numberReplicas),
+      stats(numberReplicas),
+      numberReplicas(numberReplicas),
+      exchangeInterval(exchangeInterval) {
+    for (size_t i = 0; i < numberReplicas; i++) {
+        energies[i] = 0;
+        rungs[i] = i;
+        replicaAtRung[i] = i;
+    }
+}
+
+void ReplicaExchange::publishLadder(double violationWeight, double coldest,
+                                    double hottest) {
+    this->violationWeight = violationWeight;
+    temperatures.resize(numberReplicas);
+    for (size_t i = 0; i < numberReplicas; i++) {
+        temperatures[i] =
+            (numberReplicas == 1)
+                ? coldest
+                : coldest * pow(hottest / coldest,
+                                (double)i / (numberReplicas - 1));
+    }
+    _ladderReady.store(true, memory_order_release);
+}
+
+void ReplicaExchange::proposeSwaps() {
+    for (size_t rung = numberExchangeRounds % 2; rung + 1 < numberReplicas;
+         rung += 2) {
+        size_t colder = replicaAtRung[rung], hotter = replicaAtRung[rung + 1];
+        double exponent =
+            (1 / temperatures[rung] - 1 / temperatures[rung + 1]) *
+            (energies[colder].load(memory_order_relaxed) -
+             energies[hotter].load(memory_order_relaxed));
+        ++stats[colder].numberSwapsProposed;
+        ++stats[hotter].numberSwapsProposed;
+        if (exponent < 0 && globalRandom<double>(0, 1) >= exp(exponent)) {
+            continue;
+        }
+        ++stats[colder].numberSwapsAccepted;
+        ++stats[hotter].numberSwapsAccepted;
+        replicaAtRung[rung] = hotter;
+        replicaAtRung[rung + 1] = colder;
+        rungs[hotter].store(rung, memory_order_relaxed);
+        rungs[colder].store(rung + 1, memory_order_relaxed);
+    }
+    ++numberExchangeRounds;
+}
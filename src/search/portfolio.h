@@ -0,0 +1,200 @@
+#ifndef SRC_SEARCH_PORTFOLIO_H_
+#define SRC_SEARCH_PORTFOLIO_H_
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base/base.h"
+#include "search/objective.h"
+struct Model;
+
+// A copy of the best valid assignment found by any thread.  Once published it
+// is never modified, so it can be read by several threads at once.
+struct IncumbentSolution {
+    size_t workerId;
+    UInt violation;
+    Objective objective;
+    // deep copies of the values of Model::variables, same indexing
+    std::vector<AnyValRef> values;
+    IncumbentSolution(size_t workerId, UInt violation, Objective objective)
+        : workerId(workerId),
+          violation(violation),
+          objective(std::move(objective)) {}
+};
+
+// per worker counters for the cooperative portfolio, each entry is only
+// written by its own worker thread.
+struct IncumbentSharingStats {
+    UInt64 numberImports = 0;
+    // imports after which the worker went on to find a new global best
+    UInt64 numberImportsImproved = 0;
+    bool searchingFromImport = false;
+};
+
+// Shared between the threads of a portfolio search, each thread running its
+// own independent State.  Tracks the best violation/objective found across all
+// threads so that only improvements on the global best are printed, and
+// allows one thread to signal the others to stop.
+class Portfolio {
+    std::mutex mutex;
+    bool hasIncumbent = false;
+    UInt bestViolation = 0;
+    Objective bestObjective = Objective::Undefined();
+    size_t bestWorker = 0;
+    std::atomic<bool> _finished;
+    // cooperative mode only.  The incumbent slot is published and read with
+    // the atomic shared_ptr operations, readers never take the portfolio
+    // mutex.  Only valid assignments are published, see reportSolution.
+    std::shared_ptr<const IncumbentSolution> incumbent;
+    std::vector<IncumbentSharingStats> sharingStats;
+
+    void publishIncumbent(size_t workerId, const Model& model);
+
+   public:
+    const size_t numberWorkers;
+    // if non zero, workers try to import the incumbent every syncInterval
+    // iterations.
+    const UInt64 syncInterval;
+
+    Portfolio(size_t numberWorkers, UInt64 syncInterval = 0)
+        : _finished(false),
+          sharingStats(numberWorkers),
+          numberWorkers(numberWorkers),
+          syncInterval(syncInterval) {}
+
+    inline bool cooperative() const { return syncInterval > 0; }
+
+    // returns true if the given violation/objective improves on the best found
+    // by any thread.
+    bool improvesOnIncumbent(UInt violation, const Objective& objective) const {
+        if (!hasIncumbent || violation < bestViolation) {
+            return true;
+        }
+        return violation == 0 && bestViolation == 0 &&
+               objective.isDefined() &&
+               (!bestObjective.isDefined() || objective < bestObjective);
+    }
+
+    // Called by a worker when it finds a new personal best.  If this is also a
+    // global best, the incumbent is updated and func is called, usually to
+    // print the solution.  The lock is held whilst func runs so that solutions
+    // are printed in order of improvement.  In cooperative mode, a global best
+    // without violation is also published for the other workers to import.
+    // The deep copy is not made for violation decreases, which are frequent
+    // early in the search, so that workers are not serialised on the lock
+    // whilst they improve fastest.
+    template <typename Func>
+    bool reportSolution(size_t workerId, const Model& model, UInt violation,
+                        const Objective& objective, Func&& func) {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (!improvesOnIncumbent(violation, objective)) {
+            return false;
+        }
+        hasIncumbent = true;
+        bestViolation = violation;
+        bestObjective = objective;
+        bestWorker = workerId;
+        auto& workerStats = sharingStats[workerId];
+        if (workerStats.searchingFromImport) {
+            ++workerStats.numberImportsImproved;
+            workerStats.searchingFromImport = false;
+        }
+        if (cooperative() && violation == 0) {
+            publishIncumbent(workerId, model);
+        }
+        func();
+        return true;
+    }
+
+    // read of the incumbent without the portfolio mutex, null if none has been
+    // published.  Note, std::atomic_load on a shared_ptr is not lock free in
+    // libstdc++, it takes one of a pool of internal locks for the duration of
+    // the pointer copy.
+    inline std::shared_ptr<const IncumbentSolution> getIncumbent() const {
+        return std::atomic_load(&incumbent);
+    }
+
+    // record that workerId replaced its assignment with the incumbent
+    inline void reportImport(size_t workerId) {
+        ++sharingStats[workerId].numberImports;
+        sharingStats[workerId].searchingFromImport = true;
+    }
+
+    inline const IncumbentSharingStats& getSharingStats(size_t workerId) const {
+        return sharingStats[workerId];
+    }
+
+    inline size_t getBestWorker() {
+        std::lock_guard<std::mutex> guard(mutex);
+        return bestWorker;
+    }
+
+    // request all workers to end their search
+    inline void markFinished() { _finished = true; }
+    inline bool finished() const { return _finished; }
+};
+
+// per replica counters for parallel tempering
+struct ReplicaStats {
+    // exchanges proposed between this replica and a neighbouring rung, and
+    // how many were accepted.  Only written by replica 0.
+    UInt64 numberSwapsProposed = 0;
+    UInt64 numberSwapsAccepted = 0;
+};
+
+// Parallel tempering.  Each portfolio worker is a replica running simulated
+// annealing at a fixed temperature, the temperatures forming a geometric
+// ladder.  Temperatures rather than assignments are exchanged: each replica
+// holds a rung of the ladder and every exchangeInterval of its own iterations,
+// replica 0 proposes swapping the rungs of the replicas at adjacent rungs,
+// alternating between the even and the odd pairs.  A swap is accepted with
+// the standard probability min(1, exp((1/T_i - 1/T_j) * (E_i - E_j))).  The
+// energies and rungs are exchanged through relaxed atomics, so replicas never
+// wait for each other; an energy may be an iteration or so out of date.
+class ReplicaExchange {
+    std::atomic<bool> _ladderReady;
+    // written once by replica 0 before _ladderReady is set
+    double violationWeight = 1;
+    std::vector<double> temperatures;
+    // latest energy published by each replica
+    std::vector<std::atomic<double>> energies;
+    // rung of the ladder held by each replica
+    std::vector<std::atomic<size_t>> rungs;
+    // only accessed by replica 0
+    std::vector<size_t> replicaAtRung;
+    UInt64 numberExchangeRounds = 0;
+    std::vector<ReplicaStats> stats;
+
+   public:
+    const size_t numberReplicas;
+    const UInt64 exchangeInterval;
+
+    ReplicaExchange(size_t numberReplicas, UInt64 exchangeInterval);
+
+    // called once by replica 0 when it has calibrated the temperatures
+    void publishLadder(double violationWeight, double coldest, double hottest);
+    inline bool ladderReady() const {
+        return _ladderReady.load(std::memory_order_acquire);
+    }
+    inline double getViolationWeight() const { return violationWeight; }
+    inline double getTemperature(size_t replica) const {
+        return temperatures[rungs[replica].load(std::memory_order_relaxed)];
+    }
+    inline void publishEnergy(size_t replica, double energy) {
+        energies[replica].store(energy, std::memory_order_relaxed);
+    }
+    // called by replica 0 every exchangeInterval iterations
+    void proposeSwaps();
+    inline const ReplicaStats& getStats(size_t replica) const {
+        return stats[replica];
+    }
+};
+
+// set when running a portfolio search, null when running a single search
+extern Portfolio* activePortfolio;
+// index of the portfolio worker running on this thread, 0 when not in
+// portfolio mode
+extern thread_local size_t portfolioWorkerId;
+
+#endif /* SRC_SEARCH_PORTFOLIO_H_ */
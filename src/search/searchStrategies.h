@@ -8,5 +8,7 @@ class SearchStrategy {
     virtual void run(State& state, bool isOuterMostStrategy) = 0;
     virtual ~SearchStrategy() {}
     virtual inline void printAdditionalStats(std::ostream&) {}
+    // called by explore strategies that find that the search has stagnated
+    virtual inline void notifyStagnation() {}
 };
 #endif /* SRC_SEARCH_SEARCHSTRATEGIES_H_ */
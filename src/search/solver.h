@@ -2,18 +2,21 @@
 #ifndef SRC_SEARCH_SOLVER_H_
 #define SRC_SEARCH_SOLVER_H_
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <iterator>
 
 #include "search/endOfSearchException.h"
 #include "search/model.h"
+#include "search/portfolio.h"
 #include "search/searchStrategies.h"
 #include "search/statsContainer.h"
+#include "search/varViolationTracker.h"
 #include "triggers/allTriggers.h"
 void signalEndOfSearch();
 void dumpVarViolations(const ViolationContainer& vioContainer);
-extern volatile bool sigIntActivated;
-extern volatile bool sigAlarmActivated;
+extern std::atomic<bool> sigIntActivated;
+extern std::atomic<bool> sigAlarmActivated;
 extern bool hasIterationLimit;
 extern UInt64 iterationLimit;
 extern bool hasSolutionLimit;
@@ -29,32 +32,117 @@ class State {
     bool disableVarViolations = false;
     Model model;
     ViolationContainer vioContainer;
+    VarViolationTracker varViolationTracker;
     StatsContainer stats;
     double totalTimeInNeighbourhoods = 0;
-    State(Model model) : model(std::move(model)), stats(this->model) {}
+    // best violation/objective at the last cooperative portfolio sync point,
+    // used to detect that this search has stalled
+    UInt syncBestViolation = 0;
+    Objective syncBestObjective = Objective::Undefined();
+    // the violations of the vars of each of model.varGroups, indexed by
+    // their position in the group, see syncGroupViolations
+    std::vector<ViolationContainer> groupVioContainers;
+    // the var RandomNeighbourhood drew to pick the next neighbourhood, kept
+    // by the neighbourhoods requiring several vars, see drawNeighbourhoodVars
+    lib::optional<UInt> selectedVar;
+    // reused by updateVarViolations
+    std::vector<UInt> updatedVarIds;
+    State(Model model) : model(std::move(model)), stats(this->model) {
+        // vars are drawn to pick one of their neighbourhoods, see
+        // RandomNeighbourhood
+        vioContainer.restrictSelection(this->model.varsWithNeighbourhoods());
+        groupVioContainers.resize(this->model.varGroups.size());
+        varViolationTracker.recordChangedVars =
+            !this->model.varGroups.empty();
+    }
 
-    auto makeVecFrom(AnyValRef& val) {
+    AnyValVec makeVecFrom(const std::vector<UInt>& varIndices) {
         return lib::visit(
-            [](auto& val) -> AnyValVec {
-                ValRefVec<valType(val)> vec;
-                vec.emplace_back(val);
+            [&](auto& firstVal) -> AnyValVec {
+                typedef valType(firstVal) Value;
+                ValRefVec<Value> vec;
+                for (UInt index : varIndices) {
+                    vec.emplace_back(
+                        lib::get<ValRef<Value>>(model.variables[index].second));
+                }
                 return vec;
             },
-            val);
+            model.variables[varIndices.front()].second);
     }
+
+    // the vars that neighbourhood nhIndex is to be applied to
+    std::vector<UInt> drawNeighbourhoodVars(size_t nhIndex) {
+        int group = model.neighbourhoodGroupMapping[nhIndex];
+        if (group == -1) {
+            return {(UInt)model.neighbourhoodVarMapping[nhIndex]};
+        }
+        // the selected var is kept, the others are drawn from the group with
+        // probability proportional to their violation
+        auto& members = model.varGroups[group];
+        std::vector<UInt> positions;
+        if (selectedVar && model.varGroupMapping[*selectedVar] == group) {
+            positions.emplace_back(model.varGroupPositions[*selectedVar]);
+        }
+        positions = groupVioContainers[group].selectRandomVars(
+            members.size() - 1,
+            model.neighbourhoods[nhIndex].numberValsRequired,
+            std::move(positions));
+        std::vector<UInt> vars;
+        for (UInt position : positions) {
+            vars.emplace_back(members[position]);
+        }
+        return vars;
+    }
+
     template <typename ParentStrategy>
     void runNeighbourhood(size_t nhIndex, ParentStrategy&& strategy) {
+        std::vector<UInt> varIndices = drawNeighbourhoodVars(nhIndex);
+        selectedVar.reset();
+        runNeighbourhood(varIndices, model.neighbourhoods[nhIndex], nhIndex,
+                         std::move(strategy));
+    }
+
+    // Evaluates a move of the neighbourhood without making it.  The strategy
+    // is shown the result, but the move is always rejected and is peeked at
+    // rather than applied where possible.  Nothing is reported to the stats,
+    // the var violations or the portfolio, so a sample is not an iteration.
+    // See BestOfK.
+    template <typename Strategy>
+    void sampleNeighbourhood(size_t nhIndex, Strategy&& strategy) {
+        std::vector<UInt> varIndices = drawNeighbourhoodVars(nhIndex);
         Neighbourhood& neighbourhood = model.neighbourhoods[nhIndex];
-        auto& var = model.variables[model.neighbourhoodVarMapping[nhIndex]];
-        runNeighbourhood(var, neighbourhood, nhIndex, std::move(strategy));
+        auto statsMarkPoint = stats.getMarkPoint();
+        AcceptanceCallBack callback = [&]() {
+            flushBatchedTriggers();
+            strategy(NeighbourhoodResult(model, nhIndex, varIndices, true,
+                                         statsMarkPoint));
+            return false;
+        };
+        ParentCheckCallBack alwaysTrueFunc(alwaysTrue);
+        auto changingVariables = makeVecFrom(varIndices);
+        NeighbourhoodParams params(callback, alwaysTrueFunc, 1,
+                                   changingVariables, stats, vioContainer);
+        params.sampling = true;
+        if (varIndices.size() > 1) {
+            params.vioContainers.assign(varIndices.size(), &vioContainer);
+        }
+        openTriggerBatch();
+        neighbourhood.apply(params);
+        closeTriggerBatch();
+        if (runSanityChecks &&
+            stats.numberIterations % sanityCheckInterval == 0) {
+            model.debugSanityCheck();
+        }
     }
 
     template <typename ParentStrategy>
-    void runNeighbourhood(std::pair<AnyDomainRef, AnyValRef>& var,
+    void runNeighbourhood(const std::vector<UInt>& varIndices,
                           Neighbourhood& neighbourhood,
                           lib::optional<size_t> nhIndex,
                           ParentStrategy&& strategy) {
         testForTermination();
+        ProfiledFrame profiledFrame(&neighbourhood, true,
+                                    [&]() { return neighbourhood.name; });
 
         debug_code(if (debugLogAllowed) {
             debug_log("Iteration count: "
@@ -66,29 +154,47 @@ class State {
             "Applying neighbourhood: " << neighbourhood.name << ":");
         auto statsMarkPoint = stats.getMarkPoint();
         bool solutionAccepted = false, changeMade = false;
+        // violation and objective of an accepted move that was peeked at,
+        // checked against the model once the move is applied
+        lib::optional<std::pair<UInt, Objective>> peekedResult;
         AcceptanceCallBack callback = [&]() {
-            if (runSanityChecks &&
+            flushBatchedTriggers();
+            NeighbourhoodResult result(model, nhIndex, varIndices, true,
+                                      statsMarkPoint);
+            if (runSanityChecks && !result.peeked &&
                 stats.numberIterations % sanityCheckInterval == 0) {
                 model.debugSanityCheck();
             }
             changeMade = true;
-            solutionAccepted = strategy(
-                NeighbourhoodResult(model, nhIndex, true, statsMarkPoint));
+            solutionAccepted = strategy(result);
+            if (solutionAccepted && result.peeked && runSanityChecks) {
+                peekedResult.emplace(result.getViolation(),
+                                     result.getObjective());
+            }
             return solutionAccepted;
         };
         ParentCheckCallBack alwaysTrueFunc(alwaysTrue);
-        auto changingVariables = makeVecFrom(var.second);
+        auto changingVariables = makeVecFrom(varIndices);
         NeighbourhoodParams params(callback, alwaysTrueFunc, 1,
                                    changingVariables, stats, vioContainer);
+        if (varIndices.size() > 1) {
+            params.vioContainers.assign(varIndices.size(), &vioContainer);
+        }
+        forwardedVarIds.clear();
+        openTriggerBatch();
         neighbourhood.apply(params);
-        if (runSanityChecks && !solutionAccepted &&
+        closeTriggerBatch();
+        if (runSanityChecks && (!solutionAccepted || peekedResult) &&
             stats.numberIterations % sanityCheckInterval == 0) {
             model.debugSanityCheck();
         }
-        NeighbourhoodResult nhResult(model, nhIndex, changeMade,
+        if (peekedResult) {
+            checkPeekedResult(*peekedResult);
+        }
+        NeighbourhoodResult nhResult(model, nhIndex, varIndices, changeMade,
                                      statsMarkPoint);
         if (changeMade) {
-            updateVarViolations();
+            updateVarViolations(varIndices);
         } else {
             // tell strategy that no new assignment found
             strategy(nhResult);
@@ -96,6 +202,85 @@ class State {
         stats.reportResult(solutionAccepted, nhResult);
         totalTimeInNeighbourhoods +=
             (stats.getRealTime() - nhResult.statsMarkPoint.realTime);
+        if (activePortfolio && activePortfolio->cooperative() &&
+            stats.numberIterations % activePortfolio->syncInterval == 0) {
+            syncWithPortfolio();
+        }
+    }
+
+    void checkPeekedResult(const std::pair<UInt, Objective>& peekedResult) {
+        const Objective& peekedObjective = peekedResult.second;
+        Objective objective = model.getObjective();
+        bool objectiveMatches =
+            (peekedObjective.isDefined())
+                ? objective.isDefined() && peekedObjective == objective
+                : !objective.isDefined();
+        if (peekedResult.first != model.getViolation() || !objectiveMatches) {
+            myCerr << "Error: peeked move does not match applied move.\n"
+                   << "Peeked violation " << peekedResult.first
+                   << ", objective " << peekedResult.second
+                   << "\nApplied violation " << model.getViolation()
+                   << ", objective " << objective << std::endl;
+            myAbort();
+        }
+    }
+
+    // called every syncInterval iterations in cooperative portfolio mode.  If
+    // this search has not improved on its best since the last sync point, it
+    // switches to the incumbent of the portfolio.
+    void syncWithPortfolio() {
+        bool stalled = stats.bestViolation == syncBestViolation &&
+                       !(stats.bestObjective.isDefined() &&
+                         (!syncBestObjective.isDefined() ||
+                          stats.bestObjective < syncBestObjective));
+        if (stalled) {
+            importIncumbentIfBetter();
+        }
+        syncBestViolation = stats.bestViolation;
+        syncBestObjective = stats.bestObjective;
+    }
+
+    // Replace the current assignment with the incumbent of the cooperative
+    // portfolio if it is better than the best found by this search.  Returns
+    // true if the incumbent was imported.
+    bool importIncumbentIfBetter() {
+        if (!activePortfolio || !activePortfolio->cooperative()) {
+            return false;
+        }
+        auto incumbent = activePortfolio->getIncumbent();
+        if (!incumbent || incumbent->workerId == portfolioWorkerId) {
+            return false;
+        }
+        bool better =
+            incumbent->violation < stats.bestViolation ||
+            (incumbent->violation == 0 && stats.bestViolation == 0 &&
+             incumbent->objective.isDefined() &&
+             (!stats.bestObjective.isDefined() ||
+              incumbent->objective < stats.bestObjective));
+        if (!better) {
+            return false;
+        }
+        debug_log("Importing incumbent from worker " << incumbent->workerId);
+        for (size_t i = 0; i < model.variables.size(); i++) {
+            auto& var = model.variables[i].second;
+            if (valBase(var).container == &inlinedPool) {
+                continue;
+            }
+            lib::visit(
+                [&](auto& val) {
+                    deepCopy(*lib::get<BaseType<decltype(val)>>(
+                                 incumbent->values[i]),
+                             *val);
+                },
+                var);
+        }
+        if (runSanityChecks) {
+            model.debugSanityCheck();
+        }
+        stats.importedSolution(model);
+        updateVarViolations();
+        activePortfolio->reportImport(portfolioWorkerId);
+        return true;
     }
 
     inline void testForTermination() {
@@ -120,6 +305,12 @@ class State {
 
         if (model.optimiseMode == OptimiseMode::NONE &&
             stats.bestViolation == 0) {
+            if (activePortfolio) {
+                activePortfolio->markFinished();
+            }
+            signalEndOfSearch();
+        }
+        if (activePortfolio && activePortfolio->finished()) {
             signalEndOfSearch();
         }
     }
@@ -128,11 +319,95 @@ class State {
         if (disableVarViolations) {
             return;
         }
-        vioContainer.reset();
-        if (model.csp->view()->violation == 0) {
+        varViolationTracker.rebuild(model, vioContainer);
+        syncGroupViolations();
+    }
+
+    // only the constraints referring to the changed variables are revisited,
+    // including the variables changed by forwarding from defined expressions
+    void updateVarViolations(const std::vector<UInt>& changedVarIds) {
+        if (disableVarViolations) {
+            return;
+        }
+        if (forwardedVarIds.empty()) {
+            varViolationTracker.update(model, vioContainer, changedVarIds);
+        } else {
+            updatedVarIds.assign(changedVarIds.begin(), changedVarIds.end());
+            updatedVarIds.insert(updatedVarIds.end(), forwardedVarIds.begin(),
+                                 forwardedVarIds.end());
+            varViolationTracker.update(model, vioContainer, updatedVarIds);
+        }
+        syncGroupViolations();
+        if (runSanityChecks &&
+            stats.numberIterations % sanityCheckInterval == 0) {
+            checkVarViolations();
+        }
+    }
+
+    // copy the violations of the grouped vars that may have changed from
+    // vioContainer to the containers of their groups
+    void syncGroupViolations() {
+        if (groupVioContainers.empty()) {
+            return;
+        }
+        if (varViolationTracker.allVarsChanged) {
+            for (size_t i = 0; i < groupVioContainers.size(); i++) {
+                auto& members = model.varGroups[i];
+                groupVioContainers[i].reset();
+                for (size_t j = 0; j < members.size(); j++) {
+                    groupVioContainers[i].addViolation(
+                        j, vioContainer.varViolation(members[j]));
+                }
+            }
             return;
         }
-        model.csp->updateVarViolations(0, vioContainer);
+        for (UInt var : varViolationTracker.changedVars) {
+            if (var >= model.varGroupMapping.size() ||
+                model.varGroupMapping[var] == -1) {
+                continue;
+            }
+            auto& groupVios = groupVioContainers[model.varGroupMapping[var]];
+            UInt position = model.varGroupPositions[var];
+            UInt oldViolation = groupVios.varViolation(position);
+            UInt newViolation = vioContainer.varViolation(var);
+            if (newViolation > oldViolation) {
+                groupVios.addViolation(position, newViolation - oldViolation);
+            } else {
+                groupVios.removeViolation(position,
+                                          oldViolation - newViolation);
+            }
+        }
+    }
+
+    void checkVarViolations() {
+        ViolationContainer expected;
+        if (model.getViolation() != 0) {
+            model.csp->updateVarViolations(0, expected);
+        }
+        if (!expected.sameViolations(vioContainer)) {
+            myCerr << "Error: incrementally updated var violations do not "
+                      "match a full recompute.\nExpected:\n";
+            dumpVarViolations(expected);
+            myCerr << "Actual:\n";
+            dumpVarViolations(vioContainer);
+            myAbort();
+        }
+        for (size_t i = 0; i < groupVioContainers.size(); i++) {
+            auto& members = model.varGroups[i];
+            for (size_t j = 0; j < members.size(); j++) {
+                int var = members[j];
+                if (groupVioContainers[i].varViolation(j) !=
+                    vioContainer.varViolation(var)) {
+                    myCerr << "Error: violation of var "
+                           << model.variableNames[var]
+                           << " in the container of its group is "
+                           << groupVioContainers[i].varViolation(j)
+                           << ", expected "
+                           << vioContainer.varViolation(var) << ".\n";
+                    myAbort();
+                }
+            }
+        }
     }
 
     inline void runAllRandomReassignNeighbourhoods() {
@@ -141,8 +416,7 @@ class State {
             if (valBase(var.second).container == &inlinedPool) {
                 continue;
             }
-            runNeighbourhood(model.variables[i],
-                             model.randomReassignNeighbourhoods[i],
+            runNeighbourhood({(UInt)i}, model.randomReassignNeighbourhoods[i],
                              lib::nullopt, alwaysTrueStrategy);
         }
     }
@@ -196,12 +470,14 @@ inline void evaluateAndStartTriggeringDefinedExpressions(State& state) {
 
 void search(std::shared_ptr<SearchStrategy>& searchStrategy, State& state) {
     triggerEventCount = 0;
-    std::cout << "Neighbourhoods (" << state.model.neighbourhoods.size()
-              << "):\n";
-    std::transform(state.model.neighbourhoods.begin(),
-                   state.model.neighbourhoods.end(),
-                   std::ostream_iterator<std::string>(std::cout, "\n"),
-                   [](auto& n) -> std::string& { return n.name; });
+    if (portfolioWorkerId == 0) {
+        std::cout << "Neighbourhoods (" << state.model.neighbourhoods.size()
+                  << "):\n";
+        std::transform(state.model.neighbourhoods.begin(),
+                       state.model.neighbourhoods.end(),
+                       std::ostream_iterator<std::string>(std::cout, "\n"),
+                       [](auto& n) -> std::string& { return n.name; });
+    }
 
     state.stats.startTimer();
     assignRandomValueToVariables(state);
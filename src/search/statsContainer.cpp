@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "search/model.h"
+#include "search/portfolio.h"
 #ifdef WASM_TARGET
 #include <emscripten/bind.h>
 #endif
@@ -12,19 +13,27 @@ extern bool noPrintSolutions;
 extern bool quietMode;
 extern UInt allowedViolation;
 
+UInt NeighbourhoodResult::getViolation() const {
+    return (peeked) ? model.getPeekedViolation() : model.getViolation();
+}
+
+Objective NeighbourhoodResult::getObjective() const {
+    return (peeked) ? model.getPeekedObjective() : model.getObjective();
+}
+
 Int NeighbourhoodResult::getDeltaViolation() const {
-    return model.getViolation() - statsMarkPoint.lastViolation;
+    return getViolation() - statsMarkPoint.lastViolation;
 }
 
 bool NeighbourhoodResult::objectiveStrictlyBetter() const {
-    return model.getObjective() < statsMarkPoint.lastObjective;
+    return getObjective() < statsMarkPoint.lastObjective;
 }
 bool NeighbourhoodResult::objectiveBetterOrEqual() const {
-    return model.getObjective() <= statsMarkPoint.lastObjective;
+    return getObjective() <= statsMarkPoint.lastObjective;
 }
 
 Int NeighbourhoodResult::getDeltaDefinedness() const {
-    bool currentDefined = model.objectiveDefined();
+    bool currentDefined = getObjective().isDefined();
     bool wasDefined = statsMarkPoint.lastObjective.isDefined();
     return currentDefined - wasDefined;
 }
@@ -73,6 +82,23 @@ void StatsContainer::initialSolution(Model& model) {
     checkForBestSolution(true, true, model);
 }
 
+// the assignment was replaced by one found by another search thread.  The
+// imported assignment is not counted as a solution found by this search.
+void StatsContainer::importedSolution(Model& model) {
+    lastViolation = model.csp->view()->violation;
+    lastObjective = (model.objectiveDefined()) ? model.getObjective()
+                                               : Objective::Undefined();
+    bool objImproved =
+        lastObjective.isDefined() &&
+        (!bestObjective.isDefined() || lastObjective < bestObjective);
+    if (lastViolation < bestViolation) {
+        bestViolation = lastViolation;
+        bestObjective = lastObjective;
+    } else if (bestViolation == 0 && lastViolation == 0 && objImproved) {
+        bestObjective = lastObjective;
+    }
+}
+
 #ifdef WASM_TARGET
 static const size_t WEB_STATS_REPORT_INTERVAL = 2000;
 #endif
@@ -255,10 +281,21 @@ void StatsContainer::printCurrentState(Model& model) {
         cout << (*this) << "\nTrigger event count " << triggerEventCount
              << "\n\n";
     }
-    if (lastViolation <= allowedViolation) {
-        model.tryPrintVariables();
-        model.tryRunHashChecks();
-        printStatsToWebApp(*this);
+    auto printSolution = [&]() {
+        if (lastViolation <= allowedViolation) {
+            model.tryPrintVariables();
+            model.tryRunHashChecks();
+            printStatsToWebApp(*this);
+        }
+    };
+    if (activePortfolio) {
+        // only print if this improves on the solutions of all threads.
+        // Violating assignments are still reported to track the best
+        // violation across threads.
+        activePortfolio->reportSolution(portfolioWorkerId, model, lastViolation,
+                                        lastObjective, printSolution);
+    } else {
+        printSolution();
     }
     debug_code(if (debugLogAllowed) {
         debug_log("CSP state:");
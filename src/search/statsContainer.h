@@ -33,16 +33,27 @@ struct StatsMarkPoint {
 struct NeighbourhoodResult {
     Model& model;
     lib::optional<size_t> neighbourhoodIndex;
+    // indices in model.variables of the vars the neighbourhood was applied to
+    const std::vector<UInt>& varIndices;
     bool foundAssignment;
     StatsMarkPoint statsMarkPoint;
+    // true if the move has only been peeked at (see base/peek.h), the model
+    // still holds the state before the move, the violation and objective
+    // after the move are read from the peek context.
+    bool peeked;
     NeighbourhoodResult(Model& model, lib::optional<size_t> neighbourhoodIndex,
+                        const std::vector<UInt>& varIndices,
                         bool foundAssignment,
                         const StatsMarkPoint& statsMarkPoint)
         : model(model),
           neighbourhoodIndex(neighbourhoodIndex),
+          varIndices(varIndices),
           foundAssignment(foundAssignment),
-          statsMarkPoint(statsMarkPoint) {}
+          statsMarkPoint(statsMarkPoint),
+          peeked(peekContext.active()) {}
 
+    UInt getViolation() const;
+    Objective getObjective() const;
     Int getDeltaViolation() const;
     bool objectiveStrictlyBetter() const;
     bool objectiveBetterOrEqual() const;
@@ -116,6 +127,7 @@ struct StatsContainer {
     }
 
     void initialSolution(Model& model);
+    void importedSolution(Model& model);
     void checkForBestSolution(bool vioImproved, bool objImproved, Model& model);
     void reportResult(bool solutionAccepted, const NeighbourhoodResult& result);
     void printCurrentState(Model& model);
@@ -0,0 +1,99 @@
+#include "search/varViolationTracker.h"
+
+#include <algorithm>
+
+#include "search/model.h"
+using namespace std;
+
+void VarViolationTracker::recordVars(const ViolationRecord& record) {
+    if (!recordChangedVars) {
+        return;
+    }
+    for (auto& varViolationPair : record.varViolations) {
+        changedVars.emplace_back(varViolationPair.first);
+    }
+}
+
+void VarViolationTracker::updateConstraint(ViolationContainer& vioContainer,
+                                           UInt index) {
+    auto& record = constraintViolations[index];
+    auto& constraint = (*constraints)[index];
+    if (record.empty() && constraint->view()->violation == 0) {
+        return;
+    }
+    recordVars(record);
+    vioContainer.removeViolations(record);
+    record = ViolationRecord();
+    violationDependentConstraints.erase(index);
+    if (constraint->view()->violation == 0) {
+        return;
+    }
+    scratch.reset();
+    constraint->updateVarViolations(ViolationContext(cspViolation, true),
+                                    scratch);
+    record = scratch.record();
+    recordVars(record);
+    vioContainer.addViolations(record);
+    if (scratch.modelViolationRegistered) {
+        violationDependentConstraints.insert(index);
+    }
+}
+
+void VarViolationTracker::rebuild(Model& model,
+                                  ViolationContainer& vioContainer) {
+    vioContainer.reset();
+    changedVars.clear();
+    allVarsChanged = true;
+    cspViolation = model.getViolation();
+    if (!initialised) {
+        initialised = true;
+        constraints = model.getTopLevelConstraints();
+    }
+    if (!constraints) {
+        if (cspViolation != 0) {
+            model.csp->updateVarViolations(0, vioContainer);
+        }
+        return;
+    }
+    constraintViolations.assign(constraints->size(), ViolationRecord());
+    violationDependentConstraints.clear();
+    for (size_t i = 0; i < constraints->size(); i++) {
+        updateConstraint(vioContainer, i);
+    }
+}
+
+void VarViolationTracker::update(Model& model, ViolationContainer& vioContainer,
+                                 const vector<UInt>& varIds) {
+    if (!initialised || !constraints) {
+        rebuild(model, vioContainer);
+        return;
+    }
+    changedVars.clear();
+    allVarsChanged = false;
+    constraintsToUpdate.clear();
+    auto& varConstraints = model.varConstraintMapping;
+    for (UInt varId : varIds) {
+        if (varId < varConstraints.size()) {
+            constraintsToUpdate.insert(constraintsToUpdate.end(),
+                                       varConstraints[varId].begin(),
+                                       varConstraints[varId].end());
+        }
+    }
+    UInt newCspViolation = model.getViolation();
+    bool cspViolationChanged = newCspViolation != cspViolation;
+    if (cspViolationChanged) {
+        cspViolation = newCspViolation;
+        constraintsToUpdate.insert(constraintsToUpdate.end(),
+                                   violationDependentConstraints.begin(),
+                                   violationDependentConstraints.end());
+    }
+    if (varIds.size() > 1 || cspViolationChanged) {
+        sort(constraintsToUpdate.begin(), constraintsToUpdate.end());
+        constraintsToUpdate.erase(
+            unique(constraintsToUpdate.begin(), constraintsToUpdate.end()),
+            constraintsToUpdate.end());
+    }
+    for (UInt index : constraintsToUpdate) {
+        updateConstraint(vioContainer, index);
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef SRC_SEARCH_VARVIOLATIONTRACKER_H_
+#define SRC_SEARCH_VARVIOLATIONTRACKER_H_
+#include <vector>
+
+#include "base/base.h"
+#include "search/violationContainer.h"
+#include "utils/fastIterableIntSet.h"
+struct Model;
+
+// Keeps a ViolationContainer equal to what model.csp->updateVarViolations
+// would produce, without walking the whole constraint tree after every move.
+// The violations are recorded separately for each top level constraint.
+// After a move, only the constraints that refer to the changed variable (see
+// Model::varConstraintMapping) are walked again, their old record is removed
+// from the container and the new one added.  The variables changed by
+// forwarding from defined expressions must be passed as changed too, see
+// State::updateVarViolations.
+// The top level OpAnd passes its own violation down to violating constraints,
+// some constraints (e.g. a bool variable on its own) attribute this violation
+// directly to their variables.  The walk passes the model violation in a
+// ViolationContext marked isModelViolation, variables reached by it mark the
+// scratch container.  Such constraints are also walked again whenever the
+// violation of the model changes.
+// If the top level constraints do not form a fixed list, every update falls
+// back to a full walk.
+// If recordChangedVars is set, the vars whose violation may have changed are
+// listed in changedVars, see State::syncGroupViolations.
+class VarViolationTracker {
+    bool initialised = false;
+    // the top level constraints, null if they do not form a fixed list
+    ExprRefVec<BoolView>* constraints = nullptr;
+    // violation of the model when the records were last updated
+    UInt cspViolation = 0;
+    std::vector<ViolationRecord> constraintViolations;
+    // top level constraints whose record depends on the model violation
+    FastIterableIntSet violationDependentConstraints;
+    // reused when walking a single constraint
+    ViolationContainer scratch;
+    std::vector<UInt> constraintsToUpdate;
+
+    void recordVars(const ViolationRecord& record);
+    void updateConstraint(ViolationContainer& vioContainer, UInt index);
+
+   public:
+    bool recordChangedVars = false;
+    // vars whose violation may have changed in the last call to update, with
+    // repeats.  Every var may have changed if allVarsChanged is set.
+    std::vector<UInt> changedVars;
+    bool allVarsChanged = false;
+
+    // recompute every variable's violation from scratch
+    void rebuild(Model& model, ViolationContainer& vioContainer);
+    // update the violations after the variables varIds were changed
+    void update(Model& model, ViolationContainer& vioContainer,
+                const std::vector<UInt>& varIds);
+};
+
+#endif /* SRC_SEARCH_VARVIOLATIONTRACKER_H_ */
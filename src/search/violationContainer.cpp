@@ -7,84 +7,205 @@ using namespace std;
 ViolationContainer emptyViolationContainer;
 ViolationContainer &emptyViolations = emptyViolationContainer;
 
-UInt ViolationContainer::calcMinViolation() const {
-    if (getVarsWithViolation().empty()) {
-        return 0;
+ViolationRecord ViolationContainer::record() const {
+    ViolationRecord record;
+    for (UInt var : varsWithViolation) {
+        record.varViolations.emplace_back(var, varViolations[var]);
     }
-    auto varWithMinVio = min_element(
-        getVarsWithViolation().begin(), getVarsWithViolation().end(),
-        [&](auto i, auto j) { return varViolation(i) < varViolation(j); });
-    return varViolation(*varWithMinVio);
+    for (auto &idChildPair : _childViolations) {
+        if (idChildPair.second->getTotalViolation() != 0) {
+            record.childViolations.emplace_back(idChildPair.first,
+                                                idChildPair.second->record());
+        }
+    }
+    return record;
 }
 
-static UInt findContainingInterval(const ViolationContainer &vioCont,
-                                   UInt maxVar, const double rand,
-                                   const double simulatedMinViolation) {
-    double consumedInterval = 0;
-    for (size_t varId = 0; varId <= maxVar; varId++) {
-        double violation = vioCont.varViolation(varId);
-        if (violation == 0) {
-            violation = simulatedMinViolation;
-        }
-        consumedInterval += violation;
-        if (consumedInterval >= rand) {
-            return varId;
+void ViolationContainer::addViolations(const ViolationRecord &record) {
+    for (auto &varViolationPair : record.varViolations) {
+        addViolation(varViolationPair.first, varViolationPair.second);
+    }
+    for (auto &idChildPair : record.childViolations) {
+        childViolations(idChildPair.first).addViolations(idChildPair.second);
+    }
+}
+
+void ViolationContainer::removeViolations(const ViolationRecord &record) {
+    for (auto &varViolationPair : record.varViolations) {
+        removeViolation(varViolationPair.first, varViolationPair.second);
+    }
+    for (auto &idChildPair : record.childViolations) {
+        auto &child = childViolations(idChildPair.first);
+        child.removeViolations(idChildPair.second);
+        if (child.getTotalViolation() == 0) {
+            _childViolations.erase(idChildPair.first);
         }
     }
-    assert(false);
-    myAbort();
 }
 
-static UInt pickRandomVariable(const ViolationContainer &vioCont, UInt maxVar,
-                               UInt minViolation = 0) {
-    if (vioCont.getTotalViolation() == 0) {
-        return globalRandom<UInt>(0, maxVar);
-    }
-    double simulatedMinViolation = 0;
-    double rand;
-    const UInt numberNonViolatingVars =
-        (maxVar + 1) - vioCont.getVarsWithViolation().size();
-    if (numberNonViolatingVars == 0) {
-        rand = globalRandom<double>(0, vioCont.getTotalViolation());
-    } else {
-        // There are some non violating variables, we now pretend that these
-        // variables  now have a violation of min/n where
-        // n=numberNonViolatingVars and min= the minimum violation.
-        // The idea is that the sum of all the simulated violations cannot be
-        // greater than the minimum violation.
+bool ViolationContainer::sameViolations(
+    const ViolationContainer &other) const {
+    if (totalViolation != other.totalViolation ||
+        varsWithViolation.size() != other.varsWithViolation.size()) {
+        return false;
+    }
+    for (UInt var : varsWithViolation) {
+        if (varViolation(var) != other.varViolation(var)) {
+            return false;
+        }
+    }
+    auto childrenContained = [](const ViolationContainer &u,
+                                const ViolationContainer &v) {
+        for (auto &idChildPair : u._childViolations) {
+            if (idChildPair.second->getTotalViolation() != 0 &&
+                !idChildPair.second->sameViolations(
+                    v.childViolations(idChildPair.first))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    return childrenContained(*this, other) && childrenContained(other, *this);
+}
 
-        // first calculate min violation, skip if already passed in
-        if (minViolation == 0) {
-            minViolation = vioCont.calcMinViolation();
+void ViolationContainer::restrictSelection(const vector<bool> &selectable) {
+    debug_code(assert(varsWithViolation.empty()));
+    selectableVars = selectable;
+    numberUnselectableVars = 0;
+    if (selectableVars.empty()) {
+        return;
+    }
+    reserveVar(selectableVars.size() - 1);
+    for (size_t i = 0; i < selectableVars.size(); i++) {
+        if (!selectableVars[i]) {
+            excludedVarCounts.add(i, 1);
+            ++numberUnselectableVars;
         }
-        simulatedMinViolation = ((double)minViolation) / numberNonViolatingVars;
-        // now generate a random number in the range that includes the new
-        // simulated min violations
-        rand =
-            globalRandom<double>(0, vioCont.getTotalViolation() + minViolation);
     }
-    debug_log("max = " << (vioCont.getTotalViolation() + minViolation)
+}
+
+UInt ViolationContainer::calcMinViolation() const {
+    if (numberSelectableViolating == 0) {
+        return 0;
+    }
+    return minViolations.best();
+}
+
+// the var whose interval contains point when the violations of the vars are
+// laid end to end, point must be less than the total violation
+UInt ViolationContainer::varAtViolationPoint(double point) const {
+    return violationSums.longestPrefix(
+        [&](UInt sum, size_t) { return sum <= point; });
+}
+
+// the nth (counting from 0) selectable var without violation
+UInt ViolationContainer::nonViolatingVar(UInt n) const {
+    size_t numberTracked = excludedVarCounts.size();
+    UInt numberNonViolatingTracked =
+        numberTracked - excludedVarCounts.prefixSum(numberTracked);
+    if (n >= numberNonViolatingTracked) {
+        return numberTracked + (n - numberNonViolatingTracked);
+    }
+    return excludedVarCounts.longestPrefix(
+        [&](UInt numberExcluded, size_t length) {
+            return length - numberExcluded <= n;
+        });
+}
+
+// Vars are drawn with probability proportional to their violation.  Vars
+// without violation are given a simulated violation of min/n where
+// n=numberNonViolatingVars and min= the minimum violation.  The idea is that
+// the sum of all the simulated violations cannot be greater than the minimum
+// violation.
+// remainingViolation and numberNonViolating exclude the vars already drawn,
+// drawnNonViolating lists the vars without violation already drawn.
+UInt ViolationContainer::drawVar(
+    UInt remainingViolation, UInt numberNonViolating,
+    double simulatedMinViolation,
+    const vector<UInt> &drawnNonViolating) const {
+    double rand = globalRandom<double>(
+        0, remainingViolation + simulatedMinViolation * numberNonViolating);
+    debug_log("max = " << (remainingViolation +
+                           simulatedMinViolation * numberNonViolating)
                        << " rand = " << rand);
-    return findContainingInterval(vioCont, maxVar, rand, simulatedMinViolation);
+    if (numberNonViolating == 0 ||
+        (remainingViolation > 0 && rand < remainingViolation)) {
+        return varAtViolationPoint(rand);
+    }
+    UInt n = globalRandom<UInt>(0, numberNonViolating - 1);
+    // skip the vars already drawn that come before the nth var
+    UInt index = n;
+    while (true) {
+        UInt var = nonViolatingVar(index);
+        UInt numberSkipped = count_if(drawnNonViolating.begin(),
+                                      drawnNonViolating.end(),
+                                      [&](UInt drawn) { return drawn <= var; });
+        if (n + numberSkipped == index) {
+            return var;
+        }
+        index = n + numberSkipped;
+    }
 }
 
 UInt ViolationContainer::selectRandomVar(UInt maxVar) const {
     debug_code(assert(varViolations.size() <= maxVar + 1));
-    UInt randomVar = pickRandomVariable(*this, maxVar);
+    debug_code(assert(hasSelectableVar(maxVar)));
+    const UInt numberNonViolatingVars = (maxVar + 1) - numberExcludedVars();
+    if (selectableViolation == 0) {
+        return nonViolatingVar(
+            globalRandom<UInt>(0, numberNonViolatingVars - 1));
+    }
+    double simulatedMinViolation =
+        (numberNonViolatingVars == 0)
+            ? 0
+            : ((double)calcMinViolation()) / numberNonViolatingVars;
+    UInt randomVar = drawVar(selectableViolation, numberNonViolatingVars,
+                             simulatedMinViolation, {});
     debug_code(assert(randomVar <= maxVar));
     return randomVar;
 }
 
 vector<UInt> ViolationContainer::selectRandomVars(UInt maxVar,
-                                                  size_t numberVars) const {
-    const UInt numberNonViolatingVars =
-        (maxVar + 1) - getVarsWithViolation().size();
-    UInt minViolation = (numberNonViolatingVars == 0) ? 0 : calcMinViolation();
-    vector<UInt> vars;
+                                                  size_t numberVars,
+                                                  vector<UInt> vars) const {
+    debug_code(assert(numberVars <= maxVar + 1));
+    UInt remainingViolation = selectableViolation;
+    UInt numberNonViolatingVars = (maxVar + 1) - numberExcludedVars();
+    // with no violation at all, vars are drawn uniformly
+    double simulatedMinViolation =
+        (remainingViolation == 0)
+            ? 1
+            : (numberNonViolatingVars == 0)
+                  ? 0
+                  : ((double)calcMinViolation()) / numberNonViolatingVars;
+    vector<UInt> drawnNonViolating;
+    for (UInt var : vars) {
+        UInt violation = varViolation(var);
+        if (violation == 0) {
+            drawnNonViolating.emplace_back(var);
+            --numberNonViolatingVars;
+        } else {
+            violationSums.subtract(var, violation);
+            remainingViolation -= violation;
+        }
+    }
     while (vars.size() < numberVars) {
-        UInt var = pickRandomVariable(*this, maxVar, minViolation);
-        if (std::find(vars.begin(), vars.end(), var) == vars.end()) {
-            vars.emplace_back(var);
+        UInt var = drawVar(remainingViolation, numberNonViolatingVars,
+                           simulatedMinViolation, drawnNonViolating);
+        UInt violation = varViolation(var);
+        if (violation == 0) {
+            drawnNonViolating.emplace_back(var);
+            --numberNonViolatingVars;
+        } else {
+            violationSums.subtract(var, violation);
+            remainingViolation -= violation;
+        }
+        vars.emplace_back(var);
+    }
+    for (UInt var : vars) {
+        UInt violation = varViolation(var);
+        if (violation != 0) {
+            violationSums.add(var, violation);
         }
     }
     return vars;
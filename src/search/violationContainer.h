@@ -1,6 +1,7 @@
 
 #ifndef SRC_SEARCH_VIOLATIONCONTAINER_H_
 #define SRC_SEARCH_VIOLATIONCONTAINER_H_
+#include <cassert>
 #include <iostream>
 #include <memory>
 #include <unordered_map>
@@ -8,17 +9,80 @@
 #include <vector>
 
 #include "base/intSize.h"
+#include "utils/fenwickTree.h"
+#include "utils/minMaxSegmentTree.h"
 #include "utils/random.h"
 
 class ViolationContainer;
 extern ViolationContainer& emptyViolations;
+
+// sparse copy of the violations held by a ViolationContainer, used to
+// remember what part of the model contributed so that it can later be removed
+struct ViolationRecord {
+    std::vector<std::pair<UInt, UInt>> varViolations;
+    std::vector<std::pair<UInt, ViolationRecord>> childViolations;
+    inline bool empty() const {
+        return varViolations.empty() && childViolations.empty();
+    }
+};
+
 class ViolationContainer {
     UInt totalViolation = 0;
     std::vector<UInt> varViolations;
     std::vector<UInt> varsWithViolation;
+    // position of each var in varsWithViolation, valid only for vars with
+    // violation
+    std::vector<UInt> varsWithViolationIndices;
+    // vars that selectRandomVar(s) may return, every var if empty.  Only the
+    // violations of these vars enter the selection structures below.
+    std::vector<bool> selectableVars;
+    UInt numberUnselectableVars = 0;
+    // sum and number of the violating vars that are selectable
+    UInt selectableViolation = 0;
+    UInt numberSelectableViolating = 0;
+    // indexed by var, the following allow a var to be drawn with probability
+    // proportional to its violation in O(log n).  Sampling several vars
+    // without replacement temporarily takes the violation of drawn vars out of
+    // violationSums, which is restored before returning.
+    mutable FenwickTree<UInt> violationSums;
+    // 1 for each var that can not be drawn as a var without violation, i.e.
+    // each selectable var with violation and each var that is not selectable
+    FenwickTree<UInt> excludedVarCounts;
+    // the violation of each selectable var with violation, identity()
+    // otherwise
+    MinMaxSegmentTree<true> minViolations;
     HashMap<UInt, std::unique_ptr<ViolationContainer>> _childViolations;
 
+    inline void reserveVar(UInt id) {
+        if (id < violationSums.size()) {
+            return;
+        }
+        violationSums.reserve(id + 1);
+        excludedVarCounts.reserve(id + 1);
+        while (minViolations.size() < violationSums.size()) {
+            minViolations.insert(minViolations.size(),
+                                 MinMaxSegmentTree<true>::identity());
+        }
+    }
+    inline bool isSelectable(UInt id) const {
+        return selectableVars.empty() ||
+               (id < selectableVars.size() && selectableVars[id]);
+    }
+    inline UInt numberExcludedVars() const {
+        return numberUnselectableVars + numberSelectableViolating;
+    }
+
+    UInt varAtViolationPoint(double point) const;
+    UInt nonViolatingVar(UInt n) const;
+    UInt drawVar(UInt remainingViolation, UInt numberNonViolating,
+                 double simulatedMinViolation,
+                 const std::vector<UInt>& drawnNonViolating) const;
+
    public:
+    // set when a variable is given a violation from a ViolationContext marked
+    // isModelViolation, cleared by reset()
+    bool modelViolationRegistered = false;
+
     ViolationContainer(const UInt numberVariables = 0)
         : varViolations(numberVariables, 0) {}
     inline void addViolation(UInt id, UInt violation) {
@@ -28,22 +92,84 @@ class ViolationContainer {
         if (id >= varViolations.size()) {
             varViolations.resize(id + 1, 0);
         }
+        bool selectable = isSelectable(id);
         if (varViolations[id] == 0) {
+            if (id >= varsWithViolationIndices.size()) {
+                varsWithViolationIndices.resize(id + 1);
+            }
+            varsWithViolationIndices[id] = varsWithViolation.size();
             varsWithViolation.push_back(id);
+            if (selectable) {
+                reserveVar(id);
+                excludedVarCounts.add(id, 1);
+                ++numberSelectableViolating;
+            }
         }
         varViolations[id] += violation;
         totalViolation += violation;
+        if (selectable) {
+            selectableViolation += violation;
+            violationSums.add(id, violation);
+            minViolations.set(id, varViolations[id]);
+        }
     }
 
+    // undo a previous addViolation(id, violation)
+    inline void removeViolation(UInt id, UInt violation) {
+        if (violation == 0) {
+            return;
+        }
+        debug_code(assert(varViolation(id) >= violation));
+        varViolations[id] -= violation;
+        totalViolation -= violation;
+        bool selectable = isSelectable(id);
+        if (selectable) {
+            selectableViolation -= violation;
+            violationSums.subtract(id, violation);
+        }
+        if (varViolations[id] != 0) {
+            if (selectable) {
+                minViolations.set(id, varViolations[id]);
+            }
+            return;
+        }
+        if (selectable) {
+            excludedVarCounts.subtract(id, 1);
+            --numberSelectableViolating;
+            minViolations.set(id, MinMaxSegmentTree<true>::identity());
+        }
+        UInt lastVar = varsWithViolation.back();
+        varsWithViolation[varsWithViolationIndices[id]] = lastVar;
+        varsWithViolationIndices[lastVar] = varsWithViolationIndices[id];
+        varsWithViolation.pop_back();
+        while (!varViolations.empty() && varViolations.back() == 0) {
+            varViolations.pop_back();
+        }
+    }
+
+    // linear in the number of vars with violation
     inline void reset() {
         totalViolation = 0;
-        size_t numberVariables = varViolations.size();
-        varViolations.clear();
+        selectableViolation = 0;
+        numberSelectableViolating = 0;
+        for (UInt var : varsWithViolation) {
+            if (isSelectable(var)) {
+                violationSums.subtract(var, varViolations[var]);
+                excludedVarCounts.subtract(var, 1);
+                minViolations.set(var, MinMaxSegmentTree<true>::identity());
+            }
+            varViolations[var] = 0;
+        }
         varsWithViolation.clear();
         _childViolations.clear();
-        varViolations.resize(numberVariables, 0);
+        modelViolationRegistered = false;
     }
 
+    // restrict selectRandomVar(s) to the vars i for which selectable[i] is
+    // true, for example the vars that own neighbourhoods.  Must be called
+    // whilst there are no violations.
+    void restrictSelection(const std::vector<bool>& selectable);
+
     inline UInt varViolation(size_t varIndex) const {
         return (varIndex < varViolations.size()) ? varViolations[varIndex] : 0;
     }
@@ -67,8 +193,23 @@ class ViolationContainer {
         return _childViolations.count(id);
     }
 
+    ViolationRecord record() const;
+    void addViolations(const ViolationRecord& record);
+    void removeViolations(const ViolationRecord& record);
+    // true if both containers attribute the same violations to the same
+    // vars, ignoring empty child containers
+    bool sameViolations(const ViolationContainer& other) const;
+
+    // false if no var up to maxVar can be drawn by selectRandomVar, that is
+    // if every var is unselectable
+    inline bool hasSelectableVar(UInt maxVar) const {
+        return selectableViolation > 0 || maxVar + 1 > numberExcludedVars();
+    }
     UInt selectRandomVar(UInt maxVar) const;
-    std::vector<UInt> selectRandomVars(UInt maxVar, size_t numberVars) const;
+    // vars lists vars already drawn, they are not drawn again and start the
+    // returned list
+    std::vector<UInt> selectRandomVars(UInt maxVar, size_t numberVars,
+                                       std::vector<UInt> vars = {}) const;
     UInt calcMinViolation() const;
 };
 
@@ -14,6 +14,9 @@ struct SequenceOuterTrigger : public virtual TriggerBase {
 struct SequenceMemberTrigger : public virtual TriggerBase {
     virtual void subsequenceChanged(UInt startIndex, UInt endIndex) = 0;
     virtual void positionsSwapped(UInt index1, UInt index2) = 0;
+    // speculative evaluation, see base/peek.h.  The member at index would
+    // take its peeked value.  Returns false if the trigger can not peek.
+    virtual bool peekMemberChanged(UInt) { return false; }
 };
 
 struct SequenceTrigger : public virtual SequenceOuterTrigger,
@@ -22,9 +25,57 @@ struct SequenceTrigger : public virtual SequenceOuterTrigger,
 template <>
 struct TriggerContainer<SequenceView>
     : public TriggerContainerBase<TriggerContainer<SequenceView>> {
+    typedef TriggerContainerBase<TriggerContainer<SequenceView>> Base;
     TriggerQueue<SequenceOuterTrigger> triggers;
     TriggerQueue<SequenceMemberTrigger> allMemberTriggers;
     std::vector<TriggerQueue<SequenceMemberTrigger>> singleMemberTriggers;
+    // set by operators whose subsequenceChanged events may be batched, see
+    // openTriggerBatch().  Never set for values, which may be swapped during
+    // a move.
+    bool batchable = false;
+    // the part of the container tied to the list of containers to flush.  Only
+    // the registered object may hold it, so copies and moves start with an
+    // empty state and assignment leaves the target's own state in place.
+    struct TriggerBatchState {
+        // true whilst this container is in the list of containers to flush
+        bool inTriggerBatch = false;
+        // true once flushBatchedTriggers has flushed this container, further
+        // events are then forwarded immediately until the flush ends
+        bool flushed = false;
+        // sorted, disjoint [start, end) ranges not yet forwarded to the
+        // triggers
+        std::vector<std::pair<UInt, UInt>> pendingSubsequenceChanges;
+
+        TriggerBatchState() = default;
+        TriggerBatchState(const TriggerBatchState&) {}
+        TriggerBatchState& operator=(const TriggerBatchState&) {
+            return *this;
+        }
+    };
+    TriggerBatchState batchState;
+
+    TriggerContainer() = default;
+    TriggerContainer(const TriggerContainer<SequenceView>&) = default;
+    TriggerContainer(TriggerContainer<SequenceView>&&) = default;
+    TriggerContainer<SequenceView>& operator=(
+        const TriggerContainer<SequenceView>&) = default;
+    TriggerContainer<SequenceView>& operator=(
+        TriggerContainer<SequenceView>&&) = default;
+    ~TriggerContainer() {
+        if (batchState.inTriggerBatch) {
+            removeFromTriggerBatch();
+        }
+    }
+    void deferSubsequenceChanged(UInt startIndex, UInt endIndex);
+    void removeFromTriggerBatch();
+    // forward the collected subsequenceChanged events of this container.
+    // Called before any other event so that triggers see events in order.
+    void flushPendingSubsequenceChanges();
+    inline void flushIfPending() {
+        if (!batchState.pendingSubsequenceChanges.empty()) {
+            flushPendingSubsequenceChanges();
+        }
+    }
 
     void takeFrom(TriggerContainer<SequenceView>& other) {
         triggers.takeFrom(other.triggers);
@@ -49,17 +100,25 @@ struct TriggerContainer<SequenceView>
         }
     }
     inline void notifyMemberAdded(size_t index, const AnyExprRef& newMember) {
+        flushIfPending();
         visitTriggers([&](auto& t) { t->valueAdded(index, newMember); },
                       triggers);
     }
 
     inline void notifyMemberRemoved(UInt index,
                                     const AnyExprRef& removedMember) {
+        flushIfPending();
         visitTriggers([&](auto& t) { t->valueRemoved(index, removedMember); },
                       triggers);
     }
 
     inline void notifyPositionsSwapped(UInt index1, UInt index2) {
+        if (!batchState.pendingSubsequenceChanges.empty()) {
+            // the pending changes move with the swapped members.  Marking both
+            // positions is safe, triggers recompute from the current members.
+            deferSubsequenceChanged(index1, index1 + 1);
+            deferSubsequenceChanged(index2, index2 + 1);
+        }
         visitTriggers([&](auto& t) { t->positionsSwapped(index1, index2); },
                       allMemberTriggers);
         if (index1 < singleMemberTriggers.size()) {
@@ -73,26 +132,57 @@ struct TriggerContainer<SequenceView>
     }
 
     void notifyMemberReplaced(UInt index, const AnyExprRef& oldMember) {
+        flushIfPending();
         visitAllMemberTriggersInRange(
             [&](auto& t) { t->memberReplaced(index, oldMember); }, index,
             index + 1);
     }
 
     inline void notifySubsequenceChanged(UInt startIndex, UInt endIndex) {
+        if (batchable && triggerBatchOpen && !batchState.flushed) {
+            deferSubsequenceChanged(startIndex, endIndex);
+            return;
+        }
         visitAllMemberTriggersInRange(
             [&](auto& t) { t->subsequenceChanged(startIndex, endIndex); },
             startIndex, endIndex);
     }
 
+    // speculative evaluation, see base/peek.h
+    inline bool notifyPeekMemberChanged(UInt index) {
+        auto peek = [&](auto& t) { return t->peekMemberChanged(index); };
+        if (!batchState.pendingSubsequenceChanges.empty() ||
+            !peekTriggers(peek, allMemberTriggers)) {
+            return false;
+        }
+        return index >= singleMemberTriggers.size() ||
+               peekTriggers(peek, singleMemberTriggers[index]);
+    }
+
     inline void notifyMemberDefined(UInt index) {
+        flushIfPending();
         visitTriggers([&](auto& t) { t->memberHasBecomeDefined(index); },
                       triggers);
     }
 
     inline void notifyMemberUndefined(UInt index) {
+        flushIfPending();
         visitTriggers([&](auto& t) { t->memberHasBecomeUndefined(index); },
                       triggers);
     }
+
+    void notifyEntireValueChanged() {
+        flushIfPending();
+        Base::notifyEntireValueChanged();
+    }
+    void notifyValueDefined() {
+        flushIfPending();
+        Base::notifyValueDefined();
+    }
+    void notifyValueUndefined() {
+        flushIfPending();
+        Base::notifyValueUndefined();
+    }
 };
 
 template <typename Child>
@@ -17,6 +17,15 @@ struct BoolView : public ExprInterface<BoolView>,
         }
         return false;
     }
+    // speculative evaluation, see base/peek.h.  Records that this view would
+    // take newViolation and passes the peek on to the triggers.
+    inline bool peekViolationAndNotify(UInt newViolation) {
+        if (newViolation == (UInt)peekContext.valueOf(this, violation)) {
+            return true;
+        }
+        peekContext.setValue(this, newViolation);
+        return notifyPeekValueChanged();
+    }
     void matchValueOf(BoolView& other) {
         changeValue([&]() {
             violation = other.violation;
@@ -27,10 +36,19 @@ struct BoolView : public ExprInterface<BoolView>,
     void standardSanityChecksForThisType() const;
 };
 
+// the violation of view in the move being peeked at, see base/peek.h
+inline UInt peekViolation(const BoolView& view) {
+    return peekContext.valueOf(&view, view.violation);
+}
+
 struct BoolViolationContext : public ViolationContext {
     bool negated;
     BoolViolationContext(UInt parentViolation, bool negated)
         : ViolationContext(parentViolation), negated(negated) {}
+    // passes the violation of parent on, negated or not
+    BoolViolationContext(const ViolationContext& parent, bool negated)
+        : ViolationContext(parent.parentViolation, parent.isModelViolation),
+          negated(negated) {}
 };
 
 #endif /* SRC_TYPES_BOOL_H_ */
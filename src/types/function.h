@@ -6,6 +6,7 @@
 #include "common/common.h"
 #include "triggers/functionTrigger.h"
 #include "types/sizeAttr.h"
+#include "utils/hashIndexMap.h"
 #include "utils/hashUtils.h"
 #include "utils/ignoreUnused.h"
 #include "utils/simpleCache.h"
@@ -41,7 +42,7 @@ typedef std::vector<Dimension> DimensionVec;
 struct ExplicitPreimageContainer {
     AnyExprVec preimages;
     std::vector<HashType> preimageHashes;
-    HashMap<HashType, UInt> preimageHashIndexMap;
+    HashIndexMap<UInt> preimageHashIndexMap;
     template <typename InnerViewType, EnableIfView<InnerViewType> = 0>
     inline ExprRefVec<InnerViewType>& get() {
         return lib::get<ExprRefVec<InnerViewType>>(preimages);
@@ -24,7 +24,7 @@ void invokeSetDefined<BoolValue>(ValRef<BoolValue>&) {}
 #define specialised(name)                                                   \
     template <>                                                             \
     ValRef<name##Value> make<name##Value>() {                               \
-        ValRef<name##Value> val(make_shared<name##Value>());                \
+        ValRef<name##Value> val(makeShared<name##Value>());                \
         val->setEvaluated(true);                                            \
         invokeSetDefined(val);                                              \
         return val;                                                         \
@@ -47,6 +47,9 @@ void invokeSetDefined<BoolValue>(ValRef<BoolValue>&) {}
         const ViolationContext& vioContext,                                 \
         ViolationContainer& vioContainer) {                                 \
         registerViolations(this, vioContext.parentViolation, vioContainer); \
+        if (vioContext.isModelViolation) {                                  \
+            vioContainer.modelViolationRegistered = true;                   \
+        }                                                                   \
     }                                                                       \
     ExprRef<name##View> name##Value::deepCopyForUnrollImpl(                 \
         const ExprRef<name##View>& self, const AnyIterRef&) const {         \
@@ -4,9 +4,11 @@
 #include "types/intVal.h"
 using namespace std;
 
+HashType getIntValueHash(Int value) { return HashType(value); }
+
 template <>
 HashType getValueHash<IntView>(const IntView& val) {
-    return HashType(val.value);
+    return getIntValueHash(val.value);
 }
 
 template <>
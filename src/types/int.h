@@ -23,6 +23,15 @@ struct IntView : public ExprInterface<IntView>,
         }
         return false;
     }
+    // speculative evaluation, see base/peek.h.  Records that this view would
+    // take newValue and passes the peek on to the triggers.
+    inline bool peekValueAndNotify(Int newValue) {
+        if (newValue == peekContext.valueOf(this, value)) {
+            return true;
+        }
+        peekContext.setValue(this, newValue);
+        return notifyPeekValueChanged();
+    }
     void matchValueOf(IntView& other) {
         changeValue([&]() {
             value = other.value;
@@ -32,11 +41,23 @@ struct IntView : public ExprInterface<IntView>,
     void standardSanityChecksForThisType() const;
 };
 
+// the hash getValueHash gives an IntView holding value
+HashType getIntValueHash(Int value);
+
+// the value of view in the move being peeked at, see base/peek.h
+inline Int peekValue(const IntView& view) {
+    return peekContext.valueOf(&view, view.value);
+}
+
 struct IntViolationContext : public ViolationContext {
     enum class Reason { TOO_LARGE, TOO_SMALL };
     Reason reason;
     IntViolationContext(UInt parentViolation, Reason reason)
         : ViolationContext(parentViolation), reason(reason) {}
+    // passes the violation of parent on with a different reason
+    IntViolationContext(const ViolationContext& parent, Reason reason)
+        : ViolationContext(parent.parentViolation, parent.isModelViolation),
+          reason(reason) {}
 };
 inline std::ostream& operator<<(std::ostream& os,
                                 const IntViolationContext::Reason& r) {
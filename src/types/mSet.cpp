@@ -175,7 +175,7 @@ void MSetValue::printVarBases() {
 
 void MSetView::standardSanityChecksForThisType() const {
     HashType checkCachedHashTotal(0);
-    HashMap<HashType, UInt> checkMemberCounts;
+    HashIndexMap<UInt> checkMemberCounts;
     lib::visit(
         [&](auto& members) {
             for (size_t i = 0; i < members.size(); i++) {
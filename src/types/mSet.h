@@ -8,6 +8,7 @@
 #include "common/common.h"
 #include "triggers/mSetTrigger.h"
 #include "types/sizeAttr.h"
+#include "utils/hashIndexMap.h"
 #include "utils/hashUtils.h"
 #include "utils/ignoreUnused.h"
 #include "utils/simpleCache.h"
@@ -19,7 +20,7 @@ struct MSetView : public ExprInterface<MSetView>,
     friend MSetValue;
     AnyExprVec members;
     HashType cachedHashTotal = HashType(0);
-    HashMap<HashType, UInt> memberCounts;
+    HashIndexMap<UInt> memberCounts;
     std::vector<HashType> indexHashMap;
     MSetView() {}
     MSetView(AnyExprVec members) : members(std::move(members)) {}
@@ -7,6 +7,7 @@
 #include "common/common.h"
 #include "triggers/partitionTrigger.h"
 #include "utils/fastIterableIntSet.h"
+#include "utils/hashIndexMap.h"
 #include "utils/hashUtils.h"
 #include "utils/ignoreUnused.h"
 
@@ -51,7 +52,7 @@ struct PartitionView : public ExprInterface<PartitionView>,
     };
 
     AnyExprVec members;                    // each point in the partition
-    HashMap<HashType, UInt> hashIndexMap;  // map from each point's hash to its
+    HashIndexMap<UInt> hashIndexMap;  // map from each point's hash to its
                                            // position in members above
     std::vector<PartInfo>
         partInfo;  // info on each part, should be same size as members
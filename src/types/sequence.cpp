@@ -8,6 +8,95 @@
 #include "utils/safePow.h"
 using namespace std;
 size_t numberElements(SequenceView& view) { return view.numberElements(); }
+
+bool batchTriggerPropagation = false;
+thread_local bool triggerBatchOpen = false;
+// containers with pending subsequenceChanged events, in the order they were
+// first deferred.  Entries are nulled if the container is destroyed.
+static thread_local vector<TriggerContainer<SequenceView>*> batchedContainers;
+
+void openTriggerBatch() {
+    if (batchTriggerPropagation) {
+        triggerBatchOpen = true;
+    }
+}
+
+void flushBatchedTriggers() {
+    // flushing a container usually changes its parents, which are appended
+    // to the list, so children are usually flushed before their parents and
+    // each parent sees the merged changes of all of its children.  Each
+    // container is flushed once, a container that changes again after its
+    // flush forwards those changes immediately, as without batching.
+    for (size_t i = 0; i < batchedContainers.size(); i++) {
+        auto container = batchedContainers[i];
+        if (!container) {
+            continue;
+        }
+        container->batchState.flushed = true;
+        container->flushIfPending();
+    }
+    for (auto container : batchedContainers) {
+        if (container) {
+            container->batchState.inTriggerBatch = false;
+            container->batchState.flushed = false;
+        }
+    }
+    batchedContainers.clear();
+}
+
+void closeTriggerBatch() {
+    if (triggerBatchOpen) {
+        flushBatchedTriggers();
+        triggerBatchOpen = false;
+    }
+}
+
+void TriggerContainer<SequenceView>::deferSubsequenceChanged(UInt startIndex,
+                                                            UInt endIndex) {
+    if (!batchState.inTriggerBatch) {
+        batchState.inTriggerBatch = true;
+        batchedContainers.emplace_back(this);
+    }
+    auto& ranges = batchState.pendingSubsequenceChanges;
+    // first range that could overlap or touch [startIndex, endIndex)
+    auto first = lower_bound(
+        ranges.begin(), ranges.end(), startIndex,
+        [](const pair<UInt, UInt>& range, UInt index) {
+            return range.second < index;
+        });
+    auto last = first;
+    while (last != ranges.end() && last->first <= endIndex) {
+        startIndex = min(startIndex, last->first);
+        endIndex = max(endIndex, last->second);
+        ++last;
+    }
+    if (first == last) {
+        ranges.emplace(first, startIndex, endIndex);
+    } else {
+        *first = make_pair(startIndex, endIndex);
+        ranges.erase(first + 1, last);
+    }
+}
+
+void TriggerContainer<SequenceView>::removeFromTriggerBatch() {
+    auto iter = find(batchedContainers.begin(), batchedContainers.end(), this);
+    if (iter != batchedContainers.end()) {
+        *iter = nullptr;
+    }
+    batchState.inTriggerBatch = false;
+    batchState.flushed = false;
+}
+
+void TriggerContainer<SequenceView>::flushPendingSubsequenceChanges() {
+    auto ranges = move(batchState.pendingSubsequenceChanges);
+    batchState.pendingSubsequenceChanges.clear();
+    for (auto& range : ranges) {
+        UInt startIndex = range.first, endIndex = range.second;
+        visitAllMemberTriggersInRange(
+            [&](auto& t) { t->subsequenceChanged(startIndex, endIndex); },
+            startIndex, endIndex);
+    }
+}
 template <>
 HashType getValueHash<SequenceView>(const SequenceView& val) {
     return val.cachedHashTotal.getOrSet([&]() {
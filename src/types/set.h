@@ -8,6 +8,7 @@
 #include "base/base.h"
 #include "common/common.h"
 #include "triggers/setTrigger.h"
+#include "utils/hashIndexMap.h"
 #include "utils/hashUtils.h"
 #include "utils/ignoreUnused.h"
 
@@ -17,7 +18,7 @@ static const char* NO_SET_UNDEFINED_MEMBERS =
 struct SetView : public ExprInterface<SetView>,
                  public TriggerContainer<SetView> {
     friend SetValue;
-    HashMap<HashType, size_t> hashIndexMap;
+    HashIndexMap<size_t> hashIndexMap;
     std::vector<HashType> indexHashMap;
     AnyExprVec members;
     HashType cachedHashTotal = HashType(0);
@@ -0,0 +1,96 @@
+#ifndef SRC_UTILS_FENWICKTREE_H_
+#define SRC_UTILS_FENWICKTREE_H_
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "common/common.h"
+
+// Fenwick (binary indexed) tree over a dense array of values, all zero
+// initially.  Changing a value and summing a prefix are O(log n), as is
+// finding the shortest prefix whose sum exceeds a given amount.  Growing the
+// array rebuilds the tree, so is linear in its size.
+template <typename T>
+class FenwickTree {
+    // nodes[i] holds the sum of the values in (i - lowbit(i), i], nodes[0] is
+    // unused
+    std::vector<T> nodes = std::vector<T>(1, 0);
+    // largest power of two not greater than size()
+    size_t highestBit = 0;
+
+    static inline size_t lowBit(size_t i) { return i & (~i + 1); }
+
+   public:
+    inline size_t size() const { return nodes.size() - 1; }
+
+    // grow to at least newSize values, keeping the values
+    void reserve(size_t newSize) {
+        if (newSize <= size()) {
+            return;
+        }
+        size_t newCapacity = std::max<size_t>(size(), 1);
+        while (newCapacity < newSize) {
+            newCapacity *= 2;
+        }
+        size_t oldSize = size();
+        nodes.resize(newCapacity + 1, 0);
+        // the new nodes still need the sums of the old values they cover,
+        // passed up from node to parent as when building from scratch
+        for (size_t i = 1; i <= newCapacity; ++i) {
+            size_t parent = i + lowBit(i);
+            if (parent > oldSize && parent <= newCapacity) {
+                nodes[parent] += nodes[i];
+            }
+        }
+        highestBit = 1;
+        while (highestBit * 2 <= size()) {
+            highestBit *= 2;
+        }
+    }
+
+    inline void clear() { std::fill(nodes.begin(), nodes.end(), 0); }
+
+    inline void add(size_t index, T value) {
+        debug_code(assert(index < size()));
+        for (size_t i = index + 1; i <= size(); i += lowBit(i)) {
+            nodes[i] += value;
+        }
+    }
+
+    inline void subtract(size_t index, T value) {
+        debug_code(assert(index < size()));
+        for (size_t i = index + 1; i <= size(); i += lowBit(i)) {
+            nodes[i] -= value;
+        }
+    }
+
+    // sum of the first length values
+    inline T prefixSum(size_t length) const {
+        debug_code(assert(length <= size()));
+        T sum = 0;
+        for (size_t i = length; i > 0; i -= lowBit(i)) {
+            sum += nodes[i];
+        }
+        return sum;
+    }
+
+    // the longest prefix for which keep(sum of prefix, length of prefix) holds,
+    // keep must hold for the empty prefix and once false, stay false for all
+    // longer prefixes.  Returns the length of the prefix, i.e. the index of the
+    // first value for which keep no longer holds.
+    template <typename Pred>
+    inline size_t longestPrefix(Pred&& keep) const {
+        size_t length = 0;
+        T sum = 0;
+        for (size_t step = highestBit; step > 0; step /= 2) {
+            size_t next = length + step;
+            if (next <= size() && keep(sum + nodes[next], next)) {
+                length = next;
+                sum += nodes[next];
+            }
+        }
+        return length;
+    }
+};
+
+#endif /* SRC_UTILS_FENWICKTREE_H_ */
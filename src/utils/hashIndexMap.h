@@ -0,0 +1,403 @@
+#ifndef SRC_UTILS_HASHINDEXMAP_H_
+#define SRC_UTILS_HASHINDEXMAP_H_
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "common/common.h"
+#include "utils/hashUtils.h"
+
+// Open addressing map keyed by HashType, used by the container views (and
+// operators over them) to map member hashes to indices or counts.
+// Slots are probed linearly.  Each slot has a one byte tag, empty or seven
+// bits of the key's mixed hash, and a probe checks the tags of sixteen
+// consecutive slots at once (one SSE2 compare, or a scalar loop without
+// SSE2), only comparing keys whose tag matches.  Erasing shifts the following
+// entries of the probe run back, so there are no tombstones and lookups never
+// slow down after many erasures.
+// As with ska::flat_hash_map, inserting may move every entry (invalidating
+// references and iterators) and erasing may move other entries.
+template <typename Value>
+class HashIndexMap {
+   public:
+    typedef HashType key_type;
+    typedef Value mapped_type;
+    typedef std::pair<const HashType, Value> value_type;
+
+   private:
+    static const size_t GROUP_WIDTH = 16;
+    static const size_t MIN_CAPACITY = 16;
+    static const signed char EMPTY = -128;
+
+    // entries are constructed in place only in full slots
+    union Slot {
+        value_type entry;
+        Slot() {}
+        ~Slot() {}
+    };
+
+    // tags[i] describes slot i, the first GROUP_WIDTH - 1 tags are repeated at
+    // the end so that a group can be loaded from any slot without wrapping
+    std::vector<signed char> tags;
+    std::unique_ptr<Slot[]> slots;
+    size_t capacity = 0;  // always 0 or a power of two
+    size_t numberElements = 0;
+
+    // int, bool and enum values hash to themselves, so the key is mixed before
+    // choosing its home slot and tag
+    static inline UInt64 slotHash(const HashType& key) {
+        return mixWord(std::hash<HashType>()(key));
+    }
+    inline size_t homeSlot(UInt64 hash) const { return hash & (capacity - 1); }
+    static inline signed char tagOf(UInt64 hash) {
+        return static_cast<signed char>(hash >> 57);
+    }
+
+    // bit i set if the tag of slot pos + i equals tag
+    inline UInt32 matchTag(size_t pos, signed char tag) const {
+#ifdef __SSE2__
+        __m128i group =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tags[pos]));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag)));
+#else
+        UInt32 mask = 0;
+        for (size_t i = 0; i < GROUP_WIDTH; i++) {
+            mask |= UInt32(tags[pos + i] == tag) << i;
+        }
+        return mask;
+#endif
+    }
+
+    static inline size_t lowestBit(UInt32 mask) { return __builtin_ctz(mask); }
+
+    inline void setTag(size_t pos, signed char tag) {
+        tags[pos] = tag;
+        if (pos < GROUP_WIDTH - 1) {
+            tags[capacity + pos] = tag;
+        }
+    }
+
+    // the slot holding key, or if absent, the slot it would be inserted into
+    inline std::pair<size_t, bool> probe(const HashType& key) const {
+        UInt64 hash = slotHash(key);
+        signed char tag = tagOf(hash);
+        size_t pos = homeSlot(hash);
+        while (true) {
+            UInt32 matches = matchTag(pos, tag);
+            while (matches) {
+                size_t index = (pos + lowestBit(matches)) & (capacity - 1);
+                if (slots[index].entry.first == key) {
+                    return std::make_pair(index, true);
+                }
+                matches &= matches - 1;
+            }
+            UInt32 empties = matchTag(pos, EMPTY);
+            if (empties) {
+                return std::make_pair((pos + lowestBit(empties)) & (capacity - 1),
+                                      false);
+            }
+            pos = (pos + GROUP_WIDTH) & (capacity - 1);
+        }
+    }
+
+    inline size_t findIndex(const HashType& key) const {
+        if (numberElements == 0) {
+            return capacity;
+        }
+        auto slot = probe(key);
+        return slot.second ? slot.first : capacity;
+    }
+
+    // at most three quarters of the slots are full
+    inline bool needsGrowing(size_t newSize) const {
+        return newSize * 4 > capacity * 3;
+    }
+
+    void allocate(size_t newCapacity) {
+        capacity = newCapacity;
+        tags.assign(capacity + GROUP_WIDTH - 1, EMPTY);
+        slots.reset(new Slot[capacity]);
+    }
+
+    void grow() {
+        size_t oldCapacity = capacity;
+        std::vector<signed char> oldTags = std::move(tags);
+        std::unique_ptr<Slot[]> oldSlots = std::move(slots);
+        allocate(oldCapacity == 0 ? MIN_CAPACITY : oldCapacity * 2);
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (oldTags[i] != EMPTY) {
+                auto& entry = oldSlots[i].entry;
+                UInt64 hash = slotHash(entry.first);
+                size_t index = probe(entry.first).first;
+                new (&slots[index].entry) value_type(std::move(entry));
+                setTag(index, tagOf(hash));
+                entry.~value_type();
+            }
+        }
+    }
+
+    void destroyAll() {
+        for (size_t i = 0; i < capacity && numberElements > 0; i++) {
+            if (tags[i] != EMPTY) {
+                slots[i].entry.~value_type();
+                --numberElements;
+            }
+        }
+    }
+
+    // empty slot index, moving back entries further along its probe run
+    void eraseIndex(size_t index) {
+        slots[index].entry.~value_type();
+        --numberElements;
+        size_t next = index;
+        while (true) {
+            next = (next + 1) & (capacity - 1);
+            if (tags[next] == EMPTY) {
+                break;
+            }
+            size_t home = homeSlot(slotHash(slots[next].entry.first));
+            // the entry may only move back if index is still within its run,
+            // i.e. index is not before home
+            if (((next - home) & (capacity - 1)) <
+                ((next - index) & (capacity - 1))) {
+                continue;
+            }
+            new (&slots[index].entry) value_type(std::move(slots[next].entry));
+            slots[next].entry.~value_type();
+            setTag(index, tags[next]);
+            index = next;
+        }
+        setTag(index, EMPTY);
+    }
+
+    template <bool isConst>
+    class Iterator {
+        friend HashIndexMap;
+        template <bool>
+        friend class Iterator;
+        typedef typename std::conditional<isConst, const HashIndexMap,
+                                          HashIndexMap>::type Map;
+        Map* map;
+        size_t index;
+
+        Iterator(Map* map, size_t index) : map(map), index(index) {}
+        inline void skipEmpty() {
+            while (index < map->capacity && map->tags[index] == EMPTY) {
+                ++index;
+            }
+        }
+
+       public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef HashIndexMap::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<isConst, const value_type*,
+                                          value_type*>::type pointer;
+        typedef typename std::conditional<isConst, const value_type&,
+                                          value_type&>::type reference;
+
+        Iterator() : map(nullptr), index(0) {}
+        // iterator converts to const_iterator
+        template <bool otherIsConst,
+                  typename std::enable_if<isConst && !otherIsConst, int>::type =
+                      0>
+        Iterator(const Iterator<otherIsConst>& other)
+            : map(other.map), index(other.index) {}
+
+        inline reference operator*() const {
+            return map->slots[index].entry;
+        }
+        inline pointer operator->() const { return &map->slots[index].entry; }
+        inline Iterator& operator++() {
+            ++index;
+            skipEmpty();
+            return *this;
+        }
+        inline Iterator operator++(int) {
+            Iterator old = *this;
+            ++(*this);
+            return old;
+        }
+        inline bool operator==(const Iterator& other) const {
+            return index == other.index;
+        }
+        inline bool operator!=(const Iterator& other) const {
+            return index != other.index;
+        }
+    };
+
+   public:
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    HashIndexMap() {}
+    HashIndexMap(const HashIndexMap& other) { *this = other; }
+    HashIndexMap(HashIndexMap&& other) noexcept { *this = std::move(other); }
+    ~HashIndexMap() { destroyAll(); }
+
+    HashIndexMap& operator=(const HashIndexMap& other) {
+        if (this == &other) {
+            return *this;
+        }
+        destroyAll();
+        if (other.numberElements == 0) {
+            tags.clear();
+            slots.reset();
+            capacity = 0;
+            return *this;
+        }
+        allocate(other.capacity);
+        tags = other.tags;
+        for (size_t i = 0; i < capacity; i++) {
+            if (tags[i] != EMPTY) {
+                new (&slots[i].entry) value_type(other.slots[i].entry);
+            }
+        }
+        numberElements = other.numberElements;
+        return *this;
+    }
+
+    HashIndexMap& operator=(HashIndexMap&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+        destroyAll();
+        tags = std::move(other.tags);
+        slots = std::move(other.slots);
+        capacity = other.capacity;
+        numberElements = other.numberElements;
+        other.tags.clear();
+        other.capacity = 0;
+        other.numberElements = 0;
+        return *this;
+    }
+
+    inline size_t size() const { return numberElements; }
+    inline bool empty() const { return numberElements == 0; }
+
+    inline void clear() {
+        destroyAll();
+        if (capacity > 0) {
+            std::fill(tags.begin(), tags.end(), EMPTY);
+        }
+    }
+
+    inline iterator begin() {
+        iterator iter(this, 0);
+        iter.skipEmpty();
+        return iter;
+    }
+    inline iterator end() { return iterator(this, capacity); }
+    inline const_iterator begin() const {
+        const_iterator iter(this, 0);
+        iter.skipEmpty();
+        return iter;
+    }
+    inline const_iterator end() const { return const_iterator(this, capacity); }
+
+    inline iterator find(const HashType& key) {
+        return iterator(this, findIndex(key));
+    }
+    inline const_iterator find(const HashType& key) const {
+        return const_iterator(this, findIndex(key));
+    }
+    inline size_t count(const HashType& key) const {
+        return findIndex(key) != capacity;
+    }
+
+    inline Value& at(const HashType& key) {
+        size_t index = findIndex(key);
+        if (index == capacity) {
+            throw std::out_of_range("HashIndexMap::at: key not found");
+        }
+        return slots[index].entry.second;
+    }
+    inline const Value& at(const HashType& key) const {
+        return const_cast<HashIndexMap&>(*this).at(key);
+    }
+
+    // inserts (key, Value(args...)) if key is absent, returns the entry for key
+    // and whether it was inserted
+    template <typename... Args>
+    inline std::pair<iterator, bool> emplace(const HashType& key,
+                                             Args&&... args) {
+        if (needsGrowing(numberElements + 1)) {
+            if (capacity > 0) {
+                auto slot = probe(key);
+                if (slot.second) {
+                    return std::make_pair(iterator(this, slot.first), false);
+                }
+            }
+            grow();
+        }
+        auto slot = probe(key);
+        if (slot.second) {
+            return std::make_pair(iterator(this, slot.first), false);
+        }
+        new (&slots[slot.first].entry)
+            value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+        setTag(slot.first, tagOf(slotHash(key)));
+        ++numberElements;
+        return std::make_pair(iterator(this, slot.first), true);
+    }
+
+    inline Value& operator[](const HashType& key) {
+        return emplace(key).first->second;
+    }
+
+    inline size_t erase(const HashType& key) {
+        size_t index = findIndex(key);
+        if (index == capacity) {
+            return 0;
+        }
+        eraseIndex(index);
+        return 1;
+    }
+    // unlike the standard containers, nothing is returned as erasing may move a
+    // later entry into the erased slot
+    inline void erase(const_iterator iter) {
+        debug_code(assert(iter.index < capacity && tags[iter.index] != EMPTY));
+        eraseIndex(iter.index);
+    }
+
+    friend bool operator==(const HashIndexMap& left,
+                           const HashIndexMap& right) {
+        if (left.size() != right.size()) {
+            return false;
+        }
+        for (auto& entry : left) {
+            auto iter = right.find(entry.first);
+            if (iter == right.end() || !(iter->second == entry.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend bool operator!=(const HashIndexMap& left,
+                           const HashIndexMap& right) {
+        return !(left == right);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const HashIndexMap& map) {
+        return containerToArrayString(os, map);
+    }
+};
+
+template <typename Value>
+const size_t HashIndexMap<Value>::GROUP_WIDTH;
+template <typename Value>
+const size_t HashIndexMap<Value>::MIN_CAPACITY;
+template <typename Value>
+const signed char HashIndexMap<Value>::EMPTY;
+
+#endif /* SRC_UTILS_HASHINDEXMAP_H_ */
@@ -1,5 +1,6 @@
 #include "utils/hashUtils.h"
 
+#include <cstring>
 #include <iostream>
 #include <utility>
 
@@ -7,8 +8,6 @@
 #include "base/intSize.h"
 #include "picosha2.h"
 
-HashType::HashType(UInt64 value) : value(value) {}
-
 HashType HashType::operator+(const HashType other) const {
     return HashType(value + other.value);
 }
@@ -74,12 +73,36 @@ UInt64 truncatedMurmurHash3(char* input, size_t inputSize) {
     return result[0] ^ result[1];
 }
 
-extern bool useShaHashing;
+// mixes the input a word at a time, the length is mixed in first so that
+// inputs differing only in trailing zero bytes differ
+UInt64 wordMix(char* input, size_t inputSize) {
+    UInt64 hash = mixWord(inputSize);
+    size_t i = 0;
+    for (; i + sizeof(UInt64) <= inputSize; i += sizeof(UInt64)) {
+        UInt64 word;
+        memcpy(&word, input + i, sizeof(UInt64));
+        hash = mixWord(hash ^ word);
+    }
+    if (i < inputSize) {
+        UInt64 word = 0;
+        memcpy(&word, input + i, inputSize - i);
+        hash = mixWord(hash ^ word);
+    }
+    return hash;
+}
+
 HashType mix(char* input, size_t inputSize) {
-    return (!useShaHashing) ? HashType(truncatedMurmurHash3(input, inputSize))
-                            : HashType(truncatedSha256(input, inputSize));
+    switch (hashFunction) {
+        case HashFunction::WORD_MIX:
+            return HashType(wordMix(input, inputSize));
+        case HashFunction::MURMUR3:
+            return HashType(truncatedMurmurHash3(input, inputSize));
+        case HashFunction::SHA256:
+            return HashType(truncatedSha256(input, inputSize));
+    }
+    return HashType(0);
 }
 
-HashType mix(const HashType& val) {
+HashType mixWithSelectedFunction(const HashType& val) {
     return mix(((char*)&(val.value)), sizeof(HashType));
 }
@@ -1,10 +1,31 @@
 #ifndef SRC_UTILS_HASHUTILS_H_
 #define SRC_UTILS_HASHUTILS_H_
+#include <cstdint>
 #include <iostream>
 
 #include "base/intSize.h"
 class HashType;
 
+// the function used to mix values into hashes, selected with --hash-function
+enum class HashFunction {
+    // splitmix64 style finaliser for single words, a word at a time streaming
+    // mix for longer inputs
+    WORD_MIX,
+    MURMUR3,
+    // slower, but collisions are very unlikely, see --use-strong-hashing
+    SHA256
+};
+extern HashFunction hashFunction;
+
+// bijective mix of a single 64 bit word, the finaliser of splitmix64.
+// Computed in uint64_t, as UInt64 is signed when targeting WASM.
+inline UInt64 mixWord(UInt64 word) {
+    uint64_t x = (uint64_t)word + 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return (UInt64)(x ^ (x >> 31));
+}
+
 namespace std {
 template <>
 struct hash<HashType>;
@@ -16,7 +37,7 @@ class HashType {
 
    public:
     HashType() {}
-    explicit HashType(UInt64 value);
+    explicit HashType(UInt64 value) : value(value) {}
 
     HashType operator+(const HashType other) const;
 
@@ -31,6 +52,7 @@ class HashType {
     bool operator<=(const HashType& other) const;
     friend std::ostream& operator<<(std::ostream& os, const HashType& val);
     friend HashType mix(const HashType& hash);
+    friend HashType mixWithSelectedFunction(const HashType& hash);
 };
 
 namespace std {
@@ -41,5 +63,14 @@ struct hash<HashType> {
 }  // namespace std
 
 HashType mix(char* input, size_t inputSize);
+HashType mixWithSelectedFunction(const HashType& hash);
+
+// called on every member added to, removed from or changed in a set, mset or
+// partition, so the default single word path is kept inline
+inline HashType mix(const HashType& hash) {
+    return (hashFunction == HashFunction::WORD_MIX)
+               ? HashType(mixWord(hash.value))
+               : mixWithSelectedFunction(hash);
+}
 
 #endif /* SRC_UTILS_HASHUTILS_H_*/
@@ -0,0 +1,170 @@
+#ifndef SRC_UTILS_MINMAXSEGMENTTREE_H_
+#define SRC_UTILS_MINMAXSEGMENTTREE_H_
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+#include "base/intSize.h"
+#include "common/common.h"
+
+// Segment tree over a dense array of Ints, each internal node holds the min
+// (minMode) or max of its two children.  Changing a value is O(log n), the
+// min/max of the whole array is O(1) and the k indices holding it are found in
+// O(k log n).  Inserting or erasing shifts the values after the index, so is
+// linear in the number of values shifted.
+// The values themselves are the leaves, stored contiguously from data().
+template <bool minMode>
+class MinMaxSegmentTree {
+    size_t numberValues = 0;
+    // number of leaves, a power of two.  nodes[1] is the root, the leaves
+    // start at nodes[capacity]
+    size_t capacity = 1;
+    std::vector<Int> nodes = std::vector<Int>(2, identity());
+
+    static inline Int better(Int u, Int v) {
+        return ((minMode) ? u < v : v < u) ? u : v;
+    }
+
+    inline void updateParent(size_t node) {
+        nodes[node] = better(nodes[2 * node], nodes[2 * node + 1]);
+    }
+
+    // recompute the internal nodes above leaves [first, last)
+    void rebuildAbove(size_t first, size_t last) {
+        if (first >= last) {
+            return;
+        }
+        size_t low = (first + capacity) / 2;
+        size_t high = (last - 1 + capacity) / 2;
+        while (low >= 1) {
+            for (size_t node = low; node <= high; ++node) {
+                updateParent(node);
+            }
+            low /= 2;
+            high /= 2;
+        }
+    }
+
+    // grow capacity to at least minCapacity, keeping the values
+    void grow(size_t minCapacity) {
+        size_t newCapacity = capacity;
+        while (newCapacity < minCapacity) {
+            newCapacity *= 2;
+        }
+        std::vector<Int> newNodes(2 * newCapacity, identity());
+        std::copy(data(), data() + numberValues,
+                  newNodes.begin() + newCapacity);
+        nodes = std::move(newNodes);
+        capacity = newCapacity;
+        rebuildAbove(0, numberValues);
+    }
+
+    template <typename Func>
+    void forEachBestBelow(size_t node, Func&& func) const {
+        if (nodes[node] != nodes[1]) {
+            return;
+        }
+        if (node >= capacity) {
+            size_t index = node - capacity;
+            if (index < numberValues) {
+                func(index);
+            }
+            return;
+        }
+        forEachBestBelow(2 * node, func);
+        forEachBestBelow(2 * node + 1, func);
+    }
+
+   public:
+    // value of the padding leaves, the largest Int in min mode and the
+    // smallest in max mode
+    static inline Int identity() {
+        return (minMode) ? std::numeric_limits<Int>::max()
+                         : std::numeric_limits<Int>::min();
+    }
+
+    inline size_t size() const { return numberValues; }
+    inline bool empty() const { return numberValues == 0; }
+    inline const Int* data() const { return nodes.data() + capacity; }
+    inline Int operator[](size_t index) const {
+        debug_code(assert(index < numberValues));
+        return nodes[capacity + index];
+    }
+
+    // min/max of all the values, identity() if empty
+    inline Int best() const { return nodes[1]; }
+
+    inline void set(size_t index, Int value) {
+        debug_code(assert(index < numberValues));
+        size_t node = capacity + index;
+        nodes[node] = value;
+        for (node /= 2; node >= 1; node /= 2) {
+            Int oldBest = nodes[node];
+            updateParent(node);
+            if (nodes[node] == oldBest) {
+                break;
+            }
+        }
+    }
+
+    inline void swap(size_t index1, size_t index2) {
+        Int value1 = (*this)[index1];
+        set(index1, (*this)[index2]);
+        set(index2, value1);
+    }
+
+    void insert(size_t index, Int value) {
+        debug_code(assert(index <= numberValues));
+        if (numberValues + 1 > capacity) {
+            grow(numberValues + 1);
+        }
+        Int* leaves = nodes.data() + capacity;
+        std::copy_backward(leaves + index, leaves + numberValues,
+                           leaves + numberValues + 1);
+        leaves[index] = value;
+        ++numberValues;
+        rebuildAbove(index, numberValues);
+    }
+
+    void erase(size_t index) {
+        debug_code(assert(index < numberValues));
+        Int* leaves = nodes.data() + capacity;
+        std::copy(leaves + index + 1, leaves + numberValues, leaves + index);
+        leaves[numberValues - 1] = identity();
+        rebuildAbove(index, numberValues);
+        --numberValues;
+    }
+
+    // replace the values with getValue(0), ..., getValue(newNumberValues - 1)
+    template <typename Func>
+    void assign(size_t newNumberValues, Func&& getValue) {
+        if (newNumberValues > capacity) {
+            numberValues = 0;
+            grow(newNumberValues);
+        }
+        Int* leaves = nodes.data() + capacity;
+        for (size_t i = 0; i < newNumberValues; ++i) {
+            leaves[i] = getValue(i);
+        }
+        std::fill(leaves + newNumberValues,
+                  leaves + std::max(numberValues, newNumberValues),
+                  identity());
+        size_t oldNumberValues = numberValues;
+        numberValues = newNumberValues;
+        rebuildAbove(0, std::max(oldNumberValues, newNumberValues));
+    }
+
+    inline void clear() {
+        assign(0, [](size_t) { return identity(); });
+    }
+
+    // calls func(index) for every index holding best(), in increasing order
+    // of index
+    template <typename Func>
+    void forEachBest(Func&& func) const {
+        forEachBestBelow(1, func);
+    }
+};
+
+#endif /* SRC_UTILS_MINMAXSEGMENTTREE_H_ */
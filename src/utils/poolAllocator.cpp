@@ -0,0 +1,14 @@
+#include "utils/poolAllocator.h"
+
+namespace pool {
+thread_local SizeClassPool sizeClassPools[NUMBER_SIZE_CLASSES];
+
+void* SizeClassPool::allocateFromNewChunk(size_t blockSize) {
+    // the remainder of the previous chunk (less than one block) is dropped
+    chunkPos = static_cast<char*>(::operator new(POOL_CHUNK_SIZE));
+    chunkEnd = chunkPos + (POOL_CHUNK_SIZE / blockSize) * blockSize;
+    void* block = chunkPos;
+    chunkPos += blockSize;
+    return block;
+}
+}  // namespace pool
@@ -0,0 +1,123 @@
+#ifndef SRC_UTILS_POOLALLOCATOR_H_
+#define SRC_UTILS_POOLALLOCATOR_H_
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Size class pool allocator used for the many small, short lived objects
+// created during search (values, expressions, triggers and the shared_ptr
+// control blocks that own them).  Blocks are rounded up to a multiple of
+// POOL_GRANULARITY bytes and recycled through a per thread free list for each
+// size class.  Blocks larger than POOL_MAX_BLOCK_SIZE go straight to operator
+// new.
+//
+// Chunks are never returned to the system, a block freed by a thread other
+// than the one that allocated it is simply added to the free list of the
+// freeing thread.  This keeps blocks shared between portfolio threads safe.
+// Define NO_POOL_ALLOCATION to fall back to std::make_shared, for example to
+// benchmark against the system allocator.
+
+namespace pool {
+static const size_t POOL_GRANULARITY = 16;
+static const size_t POOL_MAX_BLOCK_SIZE = 256;
+static const size_t POOL_CHUNK_SIZE = 64 * 1024;
+static const size_t NUMBER_SIZE_CLASSES =
+    POOL_MAX_BLOCK_SIZE / POOL_GRANULARITY;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+class SizeClassPool {
+    FreeBlock* freeList = nullptr;
+    char* chunkPos = nullptr;
+    char* chunkEnd = nullptr;
+
+    void* allocateFromNewChunk(size_t blockSize);
+
+   public:
+    inline void* allocate(size_t blockSize) {
+        if (freeList) {
+            FreeBlock* block = freeList;
+            freeList = block->next;
+            return block;
+        }
+        if (chunkPos && chunkPos + blockSize <= chunkEnd) {
+            void* block = chunkPos;
+            chunkPos += blockSize;
+            return block;
+        }
+        return allocateFromNewChunk(blockSize);
+    }
+
+    inline void deallocate(void* ptr) {
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = freeList;
+        freeList = block;
+    }
+};
+
+extern thread_local SizeClassPool sizeClassPools[NUMBER_SIZE_CLASSES];
+
+inline size_t sizeClassIndex(size_t bytes) {
+    return (bytes + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1;
+}
+
+inline void* allocate(size_t bytes) {
+    if (bytes == 0 || bytes > POOL_MAX_BLOCK_SIZE) {
+        return ::operator new(bytes);
+    }
+    size_t index = sizeClassIndex(bytes);
+    return sizeClassPools[index].allocate((index + 1) * POOL_GRANULARITY);
+}
+
+inline void deallocate(void* ptr, size_t bytes) {
+    if (bytes == 0 || bytes > POOL_MAX_BLOCK_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+    sizeClassPools[sizeClassIndex(bytes)].deallocate(ptr);
+}
+}  // namespace pool
+
+template <typename T>
+struct PoolAllocator {
+    typedef T value_type;
+    static_assert(alignof(T) <= pool::POOL_GRANULARITY,
+                  "PoolAllocator does not support over aligned types.");
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    inline T* allocate(size_t n) {
+        return static_cast<T*>(pool::allocate(n * sizeof(T)));
+    }
+    inline void deallocate(T* ptr, size_t n) {
+        pool::deallocate(ptr, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+    return true;
+}
+template <typename T, typename U>
+inline bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+    return false;
+}
+
+// replacement for std::make_shared, the object and its control block are
+// allocated from the pool.
+template <typename T, typename... Args>
+inline std::shared_ptr<T> makeShared(Args&&... args) {
+#ifdef NO_POOL_ALLOCATION
+    return std::make_shared<T>(std::forward<Args>(args)...);
+#else
+    return std::allocate_shared<T>(PoolAllocator<T>(),
+                                   std::forward<Args>(args)...);
+#endif
+}
+
+#endif /* SRC_UTILS_POOLALLOCATOR_H_ */
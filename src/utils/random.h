@@ -1,19 +1,122 @@
-
 #ifndef SRC_UTILS_RANDOM_H_
 #define SRC_UTILS_RANDOM_H_
 #include <cassert>
-#include <random>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #include "common/common.h"
 
-extern std::mt19937 globalRandomGenerator;
+// the algorithm of the random generators, selected with --random-generator
+enum class RandomGeneratorType {
+    // xoshiro256**, the fastest
+    XOSHIRO256,
+    // PCG64 (XSL RR 128/64), a larger period per stream
+    PCG64
+};
+extern RandomGeneratorType randomGeneratorType;
+
+// Random generator with the state of either algorithm in four words, so that
+// copying it (see BestOfK) is cheap.  The same seed always gives the same
+// sequence for the same algorithm.  Meets the requirements of a uniform random
+// bit generator, so can be passed to std::shuffle.
+class RandomGenerator {
+    uint64_t state[4];
+
+    static inline uint64_t rotateLeft(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+    static inline uint64_t splitMix(uint64_t& x) {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    inline uint64_t nextXoshiro() {
+        uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotateLeft(state[3], 45);
+        return result;
+    }
+
+    // state[0..1] is the 128 bit state, state[2..3] the (odd) increment
+    inline uint64_t nextPcg() {
+        typedef unsigned __int128 UInt128;
+        static const UInt128 MULTIPLIER =
+            (((UInt128)2549297995355413924ull) << 64) + 4865540595714422341ull;
+        UInt128 pcgState = (((UInt128)state[1]) << 64) | state[0];
+        UInt128 increment = (((UInt128)state[3]) << 64) | state[2];
+        pcgState = pcgState * MULTIPLIER + increment;
+        state[0] = (uint64_t)pcgState;
+        state[1] = (uint64_t)(pcgState >> 64);
+        uint64_t folded = state[1] ^ state[0];
+        return (folded >> (state[1] >> 58)) |
+               (folded << ((-(state[1] >> 58)) & 63));
+    }
+
+   public:
+    typedef uint64_t result_type;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    RandomGenerator(uint64_t seedValue = 0) { seed(seedValue); }
+
+    inline void seed(uint64_t seedValue) {
+        for (auto& word : state) {
+            word = splitMix(seedValue);
+        }
+        state[2] |= 1;
+    }
+
+    inline result_type operator()() {
+        return (randomGeneratorType == RandomGeneratorType::XOSHIRO256)
+                   ? nextXoshiro()
+                   : nextPcg();
+    }
+
+    // uniform in [0, range), range must be non zero.  Lemire's multiply and
+    // shift, only dividing in the rare case that the draw must be rejected to
+    // keep the distribution uniform.
+    inline uint64_t bounded(uint64_t range) {
+        typedef unsigned __int128 UInt128;
+        UInt128 product = (UInt128)(*this)() * range;
+        uint64_t low = (uint64_t)product;
+        if (low < range) {
+            uint64_t threshold = -range % range;
+            while (low < threshold) {
+                product = (UInt128)(*this)() * range;
+                low = (uint64_t)product;
+            }
+        }
+        return (uint64_t)(product >> 64);
+    }
+
+    // uniform in [0, 1)
+    inline double unitReal() {
+        return ((*this)() >> 11) * (1.0 / (UINT64_C(1) << 53));
+    }
+};
+
+extern thread_local RandomGenerator globalRandomGenerator;
+
 template <
     typename IntType,
     typename std::enable_if<std::is_integral<IntType>::value, int>::type = 0>
 inline IntType globalRandom(IntType start, IntType end) {
     debug_code(assert(end >= start));
-    std::uniform_int_distribution<IntType> distr(start, end);
-    return distr(globalRandomGenerator);
+    // computed in unsigned arithmetic, so that signed ranges can not overflow
+    uint64_t range = (uint64_t)end - (uint64_t)start + 1;
+    uint64_t offset = (range == 0) ? globalRandomGenerator()
+                                   : globalRandomGenerator.bounded(range);
+    return (IntType)((uint64_t)start + offset);
 }
 
 template <
@@ -21,8 +124,7 @@ template <
     typename std::enable_if<!std::is_integral<RealType>::value, int>::type = 0>
 inline RealType globalRandom(RealType start, RealType end) {
     debug_code(assert(end >= start));
-    std::uniform_real_distribution<RealType> distr(start, end);
-    return distr(globalRandomGenerator);
+    return start + (end - start) * (RealType)globalRandomGenerator.unitReal();
 }
 
 #endif /* SRC_UTILS_RANDOM_H_ */
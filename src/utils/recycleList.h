@@ -0,0 +1,52 @@
+#ifndef SRC_UTILS_RECYCLELIST_H_
+#define SRC_UTILS_RECYCLELIST_H_
+#include <utility>
+#include <vector>
+
+#include "base/intSize.h"
+
+struct RecycleStats {
+    UInt64 hits = 0;
+    UInt64 misses = 0;
+};
+// counts of take() calls on all RecycleLists of this thread
+extern thread_local RecycleStats recycleStats;
+
+// Bounded free list for objects that are expensive to rebuild, for example
+// expression trees rolled by quantifiers.  Objects are handed back with save()
+// and taken again with take().  Plain memory reuse is left to the pool
+// allocator, see utils/poolAllocator.h.
+template <typename T, size_t capacity>
+class RecycleList {
+    std::vector<T> storage;
+
+   public:
+    // returns false if the list is full, in which case object is left as is
+    inline bool save(T&& object) {
+        if (storage.size() == capacity) {
+            return false;
+        }
+        storage.emplace_back(std::move(object));
+        return true;
+    }
+
+    // removes the most recently saved object and passes it to func.  Returns
+    // false if the list was empty.
+    template <typename Func>
+    inline bool take(Func&& func) {
+        if (storage.empty()) {
+            ++recycleStats.misses;
+            return false;
+        }
+        T object = std::move(storage.back());
+        storage.pop_back();
+        ++recycleStats.hits;
+        func(object);
+        return true;
+    }
+
+    inline void clear() { storage.clear(); }
+    inline bool empty() const { return storage.empty(); }
+};
+
+#endif /* SRC_UTILS_RECYCLELIST_H_ */
@@ -0,0 +1,143 @@
+#ifndef SRC_UTILS_SIMDKERNELS_H_
+#define SRC_UTILS_SIMDKERNELS_H_
+#include <cstddef>
+#include <type_traits>
+
+#include "base/intSize.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Kernels over the dense Int/UInt arrays that the aggregate operators (OpSum,
+// OpProd, OpMinMax, OpAnd) keep as shadow copies of their operand values.
+// When compiled with AVX2 (cmake -DAVX2=ON) four 64 bit lanes are processed
+// per instruction, otherwise the scalar loops are used.  Both versions give
+// identical results.
+
+namespace simd {
+
+// sum of values[0..n), T must be Int or UInt
+template <typename T>
+inline T sum(const T* values, size_t n) {
+    static_assert(std::is_integral<T>::value && sizeof(T) == 8,
+                  "simd::sum expects 64 bit integers.");
+    size_t i = 0;
+    T total = 0;
+#ifdef __AVX2__
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_epi64(
+            acc,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)));
+    }
+    alignas(32) T lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+    for (; i < n; ++i) {
+        total += values[i];
+    }
+    return total;
+}
+
+// number of entries in values[0..n) equal to value
+inline size_t countEqual(const Int* values, size_t n, Int value) {
+    size_t i = 0;
+    size_t count = 0;
+#ifdef __AVX2__
+    const __m256i target = _mm256_set1_epi64x(value);
+    // equal lanes are all ones (-1), subtracting them counts matches
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4) {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(v, target));
+    }
+    alignas(32) Int lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+    for (; i < n; ++i) {
+        count += values[i] == value;
+    }
+    return count;
+}
+
+// product of the non zero entries of values[0..n).  AVX2 has no 64 bit
+// multiply, so this uses four independent scalar accumulators instead.
+inline Int productOfNonZero(const Int* values, size_t n) {
+    Int acc[4] = {1, 1, 1, 1};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            Int value = values[i + lane];
+            acc[lane] *= (value == 0) ? 1 : value;
+        }
+    }
+    for (; i < n; ++i) {
+        acc[0] *= (values[i] == 0) ? 1 : values[i];
+    }
+    return (acc[0] * acc[1]) * (acc[2] * acc[3]);
+}
+
+// smallest (minMode) or largest value in values[0..n), n must be non zero
+template <bool minMode>
+inline Int extreme(const Int* values, size_t n) {
+    size_t i = 0;
+    Int best = values[0];
+#ifdef __AVX2__
+    if (n >= 4) {
+        __m256i bestLanes =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        for (i = 4; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(values + i));
+            __m256i better = (minMode) ? _mm256_cmpgt_epi64(bestLanes, v)
+                                       : _mm256_cmpgt_epi64(v, bestLanes);
+            bestLanes = _mm256_blendv_epi8(bestLanes, v, better);
+        }
+        alignas(32) Int lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), bestLanes);
+        best = lanes[0];
+        for (size_t lane = 1; lane < 4; ++lane) {
+            if ((minMode) ? lanes[lane] < best : best < lanes[lane]) {
+                best = lanes[lane];
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if ((minMode) ? values[i] < best : best < values[i]) {
+            best = values[i];
+        }
+    }
+    return best;
+}
+
+// calls func(index) for each index in [0..n) where values[index] == value, in
+// increasing order of index.
+template <typename Func>
+inline void forEachEqual(const Int* values, size_t n, Int value, Func&& func) {
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256i target = _mm256_set1_epi64x(value);
+    for (; i + 4 <= n; i += 4) {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        int mask = _mm256_movemask_pd(
+            _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, target)));
+        while (mask) {
+            func(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (values[i] == value) {
+            func(i);
+        }
+    }
+}
+}  // namespace simd
+
+#endif /* SRC_UTILS_SIMDKERNELS_H_ */
@@ -0,0 +1,100 @@
+#!/usr/bin/env bash
+#compare the search speed (iterations per CPU second) of two athanor builds on the test instances.
+#usage: ./benchmark.sh baseline_solver candidate_solver
+#to pass a bash expansion filter for filtering instances, like you would pass to ls, then use --filter pattern
+#to change the random seed (default 0), pass --seed n
+#to override the number of iterations of every instance, pass --iteration-limit n
+#to pass extra arguments to one of the solvers, pass --baseline-args "args" or --candidate-args "args"
+#for example, to measure pool allocation, build once with cmake -DPOOL_ALLOCATION=OFF and once with the default.
+#or to compare hash functions on set heavy instances with one build:
+#./benchmark.sh --filter 'instances/*[sS]et*.essence' --baseline-args "--hash-function murmur3" athanor athanor
+#prints a csv row per instance: instance,baselineItersPerSec,candidateItersPerSec,speedup
+
+instanceFilter='instances/*.essence'
+seed=0
+iterationLimit=""
+baselineArgs=()
+candidateArgs=()
+solvers=()
+while (($# > 0)) ; do
+    flag="$1"
+    if [[ "$flag" == "--filter" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --filter takes one argument, a bash pattern." 1>&2
+            exit 1
+        fi
+        instanceFilter="$2"
+        shift
+    elif [[ "$flag" == "--seed" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --seed takes one argument, a integer." 1>&2
+            exit 1
+        fi
+        seed="$2"
+        shift
+    elif [[ "$flag" == "--iteration-limit" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --iteration-limit takes one argument, a integer." 1>&2
+            exit 1
+        fi
+        iterationLimit="$2"
+        shift
+    elif [[ "$flag" == "--baseline-args" || "$flag" == "--candidate-args" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error $flag takes one argument, a quoted list of solver arguments." 1>&2
+            exit 1
+        fi
+        if [[ "$flag" == "--baseline-args" ]] ; then
+            read -r -a baselineArgs <<< "$2"
+        else
+            read -r -a candidateArgs <<< "$2"
+        fi
+        shift
+    else
+        solvers+=("$(realpath "$flag")")
+    fi
+    shift
+done
+
+if (( ${#solvers[@]} != 2 )) ; then
+    echo "Error: usage: $0 [options] baseline_solver candidate_solver" 1>&2
+    exit 1
+fi
+
+pushd $(dirname "$0") > /dev/null
+trap "popd > /dev/null" EXIT
+
+#prints iterations per CPU second of one run, args: solver then solver args
+function itersPerSec() {
+    output="$("$@" --no-print-solutions 2>&1)"
+    if [ "$?" -ne 0 ] ; then
+        echo "error"
+        return
+    fi
+    iterations=$(echo "$output" | grep -E '^Number iterations: ' | grep -Eo '[0-9]+')
+    cpuTime=$(echo "$output" | grep -E '^Total CPU time: ' | sed 's/^Total CPU time: //')
+    awk -v i="$iterations" -v t="$cpuTime" 'BEGIN { if (t > 0) printf "%.1f", i / t; else print "inf" }'
+}
+
+echo "instance,baselineItersPerSec,candidateItersPerSec,speedup"
+for instance in $(eval ls $instanceFilter) ; do
+    for param in instances/$(basename "$instance" .essence)*.param ; do
+        if [[ "$param" == "instances/$(basename "$instance" .essence)*.param" ]] ; then
+            name="$(basename "$instance" .essence)"
+            numberIterations=$(grep -E '^\$testing:numberIterations=' "$instance" | grep -Eo '[0-9]+')
+            inputArgs=(--spec "$instance")
+        else
+            name="$(basename "$instance" .essence)-$(basename "$param" .param)"
+            numberIterations=$(grep -E '^\$testing:numberIterations=' "$param" | grep -Eo '[0-9]+')
+            inputArgs=(--spec "$instance" --param "$param")
+        fi
+        if [ -n "$iterationLimit" ] ; then
+            numberIterations="$iterationLimit"
+        fi
+        args=(--random-seed "$seed" --iteration-limit "$numberIterations" "${inputArgs[@]}")
+        baseline=$(itersPerSec "${solvers[0]}" "${args[@]}" "${baselineArgs[@]}")
+        candidate=$(itersPerSec "${solvers[1]}" "${args[@]}" "${candidateArgs[@]}")
+        speedup=$(awk -v b="$baseline" -v c="$candidate" 'BEGIN { if (b > 0 && c > 0) printf "%.3f", c / b; else print "n/a" }')
+        echo "$name,$baseline,$candidate,$speedup"
+    done
+done
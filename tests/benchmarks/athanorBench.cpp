@@ -0,0 +1,285 @@
+// Micro-benchmarks for the primitives on the hot path of every move:
+// dispatching a trigger queue, mixing a hash, FastIterableIntSet updates,
+// adding and removing set members, OpSum updates and the unrolling and rolling
+// of a quantifier over a set.  The last three build small models in the same
+// way as athanor, so they time the whole propagation of a change.
+// Build with make athanor_bench, prints a JSON object with the nanoseconds per
+// operation of each benchmark.  For end to end iterations per second, trigger
+// events per iteration and peak memory on the test instances, see
+// macroBenchmark.sh.
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+#include "parsing/jsonModelParser.h"
+#include "search/endOfSearchException.h"
+#include "search/model.h"
+#include "types/allVals.h"
+#include "utils/fastIterableIntSet.h"
+#include "utils/hashUtils.h"
+
+using namespace std;
+
+// normally defined by main.cpp, the other globals are in common/globals.cpp
+void signalEndOfSearch() { throw EndOfSearchException(); }
+
+static const size_t NUMBER_OPERATIONS = 1000000;
+static const size_t NUMBER_MODEL_CHANGES = 100000;
+
+template <typename Func>
+double nanosecondsPerOperation(size_t numberOperations, Func&& operation) {
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < numberOperations; ++i) {
+        operation(i);
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() /
+           numberOperations;
+}
+
+// the essence JSON (as output by conjure) of the models used below
+namespace essence {
+using json = nlohmann::json;
+json object(const string& key, json value) {
+    json result = json::object();
+    result[key] = move(value);
+    return result;
+}
+json constInt(Int value) {
+    return object("Constant",
+                  object("ConstantInt",
+                         json::array({object("TagInt", json::array()), value})));
+}
+json intDomain(Int from, Int to) {
+    return object(
+        "DomainInt",
+        json::array({object("TagInt", json::array()),
+                     json::array({object("RangeBounded",
+                                         json::array({constInt(from),
+                                                      constInt(to)}))})}));
+}
+json reference(const string& name) {
+    return object("Reference", json::array({object("Name", name), nullptr}));
+}
+json op(const string& name, json args) {
+    return object("Op", object(name, move(args)));
+}
+json matrix(const vector<json>& elements) {
+    return object("AbstractLiteral",
+                  object("AbsLitMatrix",
+                         json::array({intDomain(1, elements.size()),
+                                      json(elements)})));
+}
+json findDecl(const string& name, json domain) {
+    return object("Declaration",
+                  object("FindOrGiven", json::array({"Find",
+                                                     object("Name", name),
+                                                     move(domain)})));
+}
+json setDomain(UInt maxSize, json inner) {
+    return object("DomainSet",
+                  json::array({object("Set_Occurrence", json::array()),
+                               object("SizeAttr_MaxSize", constInt(maxSize)),
+                               move(inner)}));
+}
+json sumOverSet(const string& set) {
+    json generator = object(
+        "Generator",
+        object("GenInExpr", json::array({object("Single", object("Name", "j")),
+                                         reference(set)})));
+    return op("MkOpSum",
+              object("Comprehension",
+                     json::array({reference("j"), json::array({generator})})));
+}
+}  // namespace essence
+
+// builds the model and starts triggering, as at the start of a search.  Int
+// variables take the value 1, sets start empty.
+Model buildModel(const vector<nlohmann::json>& statements) {
+    vector<nlohmann::json> jsons = {
+        essence::object("mStatements", nlohmann::json(statements))};
+    // keep stdout to the JSON results
+    ostringstream buildOutput;
+    auto coutBuffer = cout.rdbuf(buildOutput.rdbuf());
+    ParsedModel parsedModel = parseModelFromJson(jsons);
+    Model model = parsedModel.builder->build();
+    cout.rdbuf(coutBuffer);
+    for (auto& var : model.variables) {
+        if (auto* intVal = lib::get_if<ValRef<IntValue>>(&var.second)) {
+            (*intVal)->value = 1;
+        }
+    }
+    TriggerDepthTracker depth;
+    model.csp->evaluate();
+    model.csp->startTriggering();
+    lib::visit(
+        [&](auto& objective) {
+            objective->evaluate();
+            objective->startTriggering();
+        },
+        model.objective);
+    handleDefinedVarTriggers();
+    return model;
+}
+
+struct CountingTrigger : public IntTrigger {
+    UInt64& count;
+    CountingTrigger(UInt64& count) : count(count) {}
+    void valueChanged() final { ++count; }
+    void reattachTrigger() final {}
+    void hasBecomeUndefined() final {}
+    void hasBecomeDefined() final {}
+};
+
+// nanoseconds per trigger called
+double triggerQueueDispatch(UInt64& checksum) {
+    static const size_t NUMBER_TRIGGERS = 8;
+    TriggerQueue<IntTrigger> queue;
+    for (size_t i = 0; i < NUMBER_TRIGGERS; i++) {
+        queue.add(make_shared<CountingTrigger>(checksum));
+    }
+    return nanosecondsPerOperation(
+               NUMBER_OPERATIONS / NUMBER_TRIGGERS,
+               [&](size_t) {
+                   visitTriggers([&](auto& t) { t->valueChanged(); }, queue);
+               }) /
+           NUMBER_TRIGGERS;
+}
+
+double hashMix(UInt64& checksum) {
+    mt19937_64 rng(0);
+    vector<HashType> values(NUMBER_OPERATIONS);
+    for (auto& value : values) {
+        value = HashType(rng());
+    }
+    HashType total(0);
+    double time = nanosecondsPerOperation(
+        NUMBER_OPERATIONS, [&](size_t i) { total += mix(values[i]); });
+    checksum += (total == HashType(0));
+    return time;
+}
+
+// nanoseconds per insert or erase
+double fastIterableIntSetUpdates(UInt64& checksum) {
+    static const Int MAX_ELEMENT = 1000;
+    mt19937_64 rng(0);
+    uniform_int_distribution<Int> elementDist(0, MAX_ELEMENT);
+    vector<Int> elements(NUMBER_OPERATIONS);
+    for (auto& element : elements) {
+        element = elementDist(rng);
+    }
+    FastIterableIntSet set(0, MAX_ELEMENT);
+    double time = nanosecondsPerOperation(NUMBER_OPERATIONS, [&](size_t i) {
+        if (set.count(elements[i])) {
+            set.erase(elements[i]);
+        } else {
+            set.insert(elements[i]);
+        }
+    });
+    checksum += set.size();
+    return time;
+}
+
+// adds members to the set variable s until it is full, then removes them
+// all, repeatedly.  Returns nanoseconds per member added or removed.
+double setAddRemove(Model& model, UInt64& checksum) {
+    auto& set = *lib::get<ValRef<SetValue>>(model.variables.front().second);
+    UInt maxSize =
+        lib::get<shared_ptr<SetDomain>>(model.variables.front().first)
+            ->sizeAttr.maxSize;
+    vector<ValRef<IntValue>> members;
+    for (UInt i = 0; i < maxSize; i++) {
+        members.emplace_back(make<IntValue>());
+        members.back()->value = i + 1;
+    }
+    auto alwaysTrue = []() { return true; };
+    double time =
+        nanosecondsPerOperation(NUMBER_MODEL_CHANGES, [&](size_t i) {
+            size_t round = i / maxSize;
+            if (round % 2 == 0) {
+                set.tryAddMember(members[i % maxSize], alwaysTrue);
+            } else {
+                set.tryRemoveMember<IntValue>(set.numberElements() - 1,
+                                              alwaysTrue);
+            }
+        });
+    checksum += model.getViolation();
+    return time;
+}
+
+// assigns the int variables in turn, returns nanoseconds per assignment
+double intAssignments(Model& model, UInt64& checksum) {
+    vector<IntValue*> vals;
+    for (auto& var : model.variables) {
+        vals.emplace_back(&(*lib::get<ValRef<IntValue>>(var.second)));
+    }
+    double time =
+        nanosecondsPerOperation(NUMBER_MODEL_CHANGES, [&](size_t i) {
+            auto& val = *vals[i % vals.size()];
+            val.changeValue([&]() {
+                val.value = ((i / vals.size()) % 100) + 1;
+                return true;
+            });
+        });
+    checksum += model.getViolation();
+    return time;
+}
+
+int main() {
+    using namespace essence;
+    static const UInt NUMBER_SUM_OPERANDS = 100;
+    static const UInt SET_MAX_SIZE = 50;
+
+    // a sum of int variables as the objective
+    vector<json> sumModel;
+    vector<json> operands;
+    for (UInt i = 0; i < NUMBER_SUM_OPERANDS; i++) {
+        string name = "a" + to_string(i);
+        sumModel.emplace_back(findDecl(name, intDomain(1, 100)));
+        operands.emplace_back(reference(name));
+    }
+    sumModel.emplace_back(object(
+        "Objective",
+        json::array({"Minimising", op("MkOpSum", matrix(operands))})));
+
+    // a set observed only by its size
+    vector<json> setModel = {
+        findDecl("s", setDomain(SET_MAX_SIZE, intDomain(1, SET_MAX_SIZE))),
+        object("SuchThat",
+               json::array({op("MkOpLeq",
+                               json::array({op("MkOpTwoBars", reference("s")),
+                                            constInt(SET_MAX_SIZE)}))}))};
+
+    // a set summed by a quantifier, each added member is unrolled and each
+    // removed member rolled
+    vector<json> quantifierModel = {
+        findDecl("s", setDomain(SET_MAX_SIZE, intDomain(1, SET_MAX_SIZE))),
+        object("Objective", json::array({"Maximising", sumOverSet("s")}))};
+
+    UInt64 checksum = 0;
+    json results;
+    results["triggerQueueDispatch"] = triggerQueueDispatch(checksum);
+    results["hashMix"] = hashMix(checksum);
+    results["fastIterableIntSet"] = fastIterableIntSetUpdates(checksum);
+    {
+        Model model = buildModel(setModel);
+        results["setAddRemove"] = setAddRemove(model, checksum);
+    }
+    {
+        Model model = buildModel(sumModel);
+        results["opSumUpdate"] = intAssignments(model, checksum);
+    }
+    {
+        Model model = buildModel(quantifierModel);
+        results["quantifierUnrollRoll"] = setAddRemove(model, checksum);
+    }
+    json output = object("unit", "nanosecondsPerOperation");
+    output["benchmarks"] = results;
+    cout << output.dump(4) << endl;
+    // the work can not be optimised away as the checksum is printed
+    cerr << "checksum " << checksum << "\n";
+}
@@ -0,0 +1,60 @@
+// Micro-benchmark for the hash functions selectable with --hash-function.
+// Times mix() of a single HashType, as done for every member added to,
+// removed from or changed in a set, mset or partition, and of two words, as
+// done for every member of a sequence or function.
+// Build with make hashBenchmark, prints a csv row per hash function.  For end
+// to end iterations per second, see benchmark.sh --baseline-args.
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils/hashUtils.h"
+
+using namespace std;
+
+HashFunction hashFunction = HashFunction::WORD_MIX;
+
+static const size_t NUMBER_HASHES = 1000000;
+
+template <typename Func>
+double nanosecondsPerHash(Func&& hashOne) {
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < NUMBER_HASHES; ++i) {
+        hashOne(i);
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() /
+           NUMBER_HASHES;
+}
+
+int main() {
+    mt19937_64 rng(0);
+    vector<HashType> values(NUMBER_HASHES);
+    for (auto& value : values) {
+        value = HashType(rng());
+    }
+    vector<pair<string, HashFunction>> functions = {
+        {"word-mix", HashFunction::WORD_MIX},
+        {"murmur3", HashFunction::MURMUR3},
+        {"sha256", HashFunction::SHA256}};
+    cout << "hashFunction,singleWordNsPerHash,twoWordNsPerHash\n";
+    for (auto& nameFunctionPair : functions) {
+        hashFunction = nameFunctionPair.second;
+        // the hashes are accumulated, like cachedHashTotal, so that the work
+        // can not be optimised away
+        HashType total(0);
+        double singleWordTime = nanosecondsPerHash(
+            [&](size_t i) { total += mix(values[i]); });
+        double twoWordTime = nanosecondsPerHash([&](size_t i) {
+            HashType input[2];
+            input[0] = HashType(i);
+            input[1] = values[i];
+            total += mix(((char*)input), sizeof(input));
+        });
+        cout << nameFunctionPair.first << "," << singleWordTime << ","
+             << twoWordTime << "\n";
+        cerr << "checksum " << total << "\n";
+    }
+}
@@ -0,0 +1,81 @@
+// Micro-benchmark for the min/max maintained by OpMinMax.  Simulates moves that
+// each change the operand currently holding the minimum, the worst case for
+// OpMinMax as the new minimum must be found.  Compares a rescan of a dense
+// array of operand values (how OpMinMax used to find it) with the segment tree
+// OpMinMax now uses.
+// Build with make minMaxBenchmark, prints a csv row per operand count.
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "utils/minMaxSegmentTree.h"
+#include "utils/simdKernels.h"
+
+using namespace std;
+
+static const size_t NUMBER_MOVES = 20000;
+static const Int MAX_VALUE = 1000000;
+
+template <typename Func>
+double nanosecondsPerMove(Func&& makeMove) {
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < NUMBER_MOVES; ++i) {
+        makeMove();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / NUMBER_MOVES;
+}
+
+int main() {
+    cout << "numberOperands,rescanNsPerMove,segmentTreeNsPerMove,speedup\n";
+    for (size_t numberOperands = 16; numberOperands <= (1u << 20);
+         numberOperands *= 4) {
+        mt19937_64 rng(0);
+        uniform_int_distribution<Int> valueDist(0, MAX_VALUE);
+        vector<Int> initialValues(numberOperands);
+        for (auto& value : initialValues) {
+            value = valueDist(rng);
+        }
+
+        // the number of indices found is accumulated so that the work can
+        // not be optimised away
+        size_t checksum = 0;
+        vector<Int> values = initialValues;
+        vector<size_t> minIndices;
+        auto rescan = [&]() {
+            Int minValue = simd::extreme<true>(values.data(), values.size());
+            minIndices.clear();
+            simd::forEachEqual(values.data(), values.size(), minValue,
+                               [&](size_t i) { minIndices.push_back(i); });
+        };
+        rescan();
+        rng.seed(1);
+        double rescanTime = nanosecondsPerMove([&]() {
+            values[minIndices.front()] = valueDist(rng);
+            rescan();
+            checksum += minIndices.size();
+        });
+
+        MinMaxSegmentTree<true> tree;
+        tree.assign(numberOperands,
+                    [&](size_t i) { return initialValues[i]; });
+        auto findMin = [&]() {
+            minIndices.clear();
+            tree.forEachBest([&](size_t i) { minIndices.push_back(i); });
+        };
+        findMin();
+        rng.seed(1);
+        double treeTime = nanosecondsPerMove([&]() {
+            tree.set(minIndices.front(), valueDist(rng));
+            findMin();
+            checksum -= minIndices.size();
+        });
+        if (checksum != 0) {
+            cerr << "Error: rescan and segment tree disagree.\n";
+            return 1;
+        }
+        cout << numberOperands << "," << rescanTime << "," << treeTime << ","
+             << (rescanTime / treeTime) << "\n";
+    }
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env bash
+#measure the search speed of an athanor build on the test instances, with fixed seeds and iteration limits.
+#usage: ./macroBenchmark.sh solver
+#to pass a bash expansion filter for filtering instances, like you would pass to ls, then use --filter pattern
+#to change the random seed (default 0), pass --seed n
+#to override the number of iterations of every instance, pass --iteration-limit n
+#to pass extra arguments to the solver, pass --solver-args "args"
+#prints a JSON array with an object per instance holding the iterations per CPU second, trigger events per iteration and peak resident memory in KB.
+#to compare two builds, see benchmark.sh, for micro benchmarks of single operations, make athanor_bench.
+
+instanceFilter='instances/*.essence'
+seed=0
+iterationLimit=""
+solverArgs=()
+solver=""
+while (($# > 0)) ; do
+    flag="$1"
+    if [[ "$flag" == "--filter" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --filter takes one argument, a bash pattern." 1>&2
+            exit 1
+        fi
+        instanceFilter="$2"
+        shift
+    elif [[ "$flag" == "--seed" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --seed takes one argument, a integer." 1>&2
+            exit 1
+        fi
+        seed="$2"
+        shift
+    elif [[ "$flag" == "--iteration-limit" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error --iteration-limit takes one argument, a integer." 1>&2
+            exit 1
+        fi
+        iterationLimit="$2"
+        shift
+    elif [[ "$flag" == "--solver-args" ]] ; then
+        if (($# < 2 )) ; then
+            echo "Error $flag takes one argument, a quoted list of solver arguments." 1>&2
+            exit 1
+        fi
+        read -r -a solverArgs <<< "$2"
+        shift
+    elif [ -z "$solver" ] ; then
+        solver="$(realpath "$flag")"
+    else
+        echo "Error: usage: $0 [options] solver" 1>&2
+        exit 1
+    fi
+    shift
+done
+
+if [ -z "$solver" ] ; then
+    echo "Error: usage: $0 [options] solver" 1>&2
+    exit 1
+fi
+
+pushd $(dirname "$0") > /dev/null
+trap "popd > /dev/null" EXIT
+
+#prints the JSON object of one run, args: instance name, iteration limit then solver args
+function runInstance() {
+    name="$1"
+    numberIterations="$2"
+    shift 2
+    output="$("$solver" "$@" --no-print-solutions 2>&1)"
+    if [ "$?" -ne 0 ] ; then
+        echo "    {\"instance\": \"$name\", \"error\": true}"
+        return
+    fi
+    iterations=$(echo "$output" | grep -E '^Number iterations: ' | grep -Eo '[0-9]+')
+    cpuTime=$(echo "$output" | grep -E '^Total CPU time: ' | sed 's/^Total CPU time: //')
+    triggerEvents=$(echo "$output" | grep -E '^Trigger event count ' | grep -Eo '[0-9]+')
+    peakMemory=$(echo "$output" | grep -E '^Peak resident memory \(KB\): ' | grep -Eo '[0-9]+$')
+    awk -v name="$name" -v l="$numberIterations" -v i="$iterations" -v t="$cpuTime" -v e="$triggerEvents" -v m="$peakMemory" 'BEGIN {
+        printf "    {\"instance\": \"%s\", \"iterationLimit\": %d, \"iterations\": %d, \"cpuTime\": %s, ", name, l, i, t
+        printf "\"iterationsPerSecond\": %.1f, ", (t > 0) ? i / t : 0
+        printf "\"triggerEventsPerIteration\": %.1f, ", (i > 0) ? e / i : 0
+        printf "\"peakResidentMemoryKB\": %d}", m
+    }'
+}
+
+echo "["
+first=1
+for instance in $(eval ls $instanceFilter) ; do
+    for param in instances/$(basename "$instance" .essence)*.param ; do
+        if [[ "$param" == "instances/$(basename "$instance" .essence)*.param" ]] ; then
+            name="$(basename "$instance" .essence)"
+            numberIterations=$(grep -E '^\$testing:numberIterations=' "$instance" | grep -Eo '[0-9]+')
+            inputArgs=(--spec "$instance")
+        else
+            name="$(basename "$instance" .essence)-$(basename "$param" .param)"
+            numberIterations=$(grep -E '^\$testing:numberIterations=' "$param" | grep -Eo '[0-9]+')
+            inputArgs=(--spec "$instance" --param "$param")
+        fi
+        if [ -n "$iterationLimit" ] ; then
+            numberIterations="$iterationLimit"
+        fi
+        if ((first == 0)) ; then
+            echo ","
+        fi
+        first=0
+        runInstance "$name" "$numberIterations" --random-seed "$seed" --iteration-limit "$numberIterations" "${inputArgs[@]}" "${solverArgs[@]}"
+    done
+done
+echo ""
+echo "]"
@@ -2,6 +2,7 @@
 #to use release build pass --use-release-build
 # to pass a bash expansion filter for filtering instances, like you would pass to ls, then use --filter pattern
 #to run sanity checks every n iterations (default 50) , pass --sanity-check-intervals n 
+#each instance is run once per solver configuration listed below, to only run one of them pass --configuration name
 
 #default: ./runAll.sh --sanity-check-intervals 50 --use-release-build
 pushd $(dirname "$0") > /dev/null
@@ -14,6 +15,10 @@ numberHeadTailSolutions=15
 instanceFilter='instances/*.essence'
 skip=0
 sanityCheckIntervals=50
+#the extra solver flags of each configuration, so that the search options that change how moves are evaluated and accepted are sanity checked too
+configurationNames=(default batch-triggers cooperate peek-moves best-of-k hash-murmur3 model-cache tabu annealing tempering)
+configurationFlags=("" "--batch-triggers" "--threads 2 --cooperate" "--peek-moves" "--nh-search best-of-k" "--hash-function murmur3" "--model-cache output/model-cache" "--improve tabu" "--improve annealing" "--threads 2 --tempering")
+configurationFilter=""
 while (($# > 0)) ; do
     flag="$1"
     if [[ "$flag" == "--use-release-build" ]] ; then
@@ -38,6 +43,14 @@ while (($# > 0)) ; do
         sanityCheckIntervals="$2"
         echo "sanityCheckIntervals=$sanityCheckIntervals"
         shift
+    elif [[ "$flag" == "--configuration" ]] ; then
+        if (($# < 2 )) ; then 
+            echo "Error --configuration takes one argument, one of: ${configurationNames[*]}" 
+            exit 1
+        fi
+        configurationFilter="$2"
+        echo "configurationFilter=$configurationFilter"
+        shift
     else 
         echo "bad argument, see test docs." 1>&2
         exit 1
@@ -138,23 +151,34 @@ function runCommand() {
     echo "command=$@" >> "$outputFile"
     "$@" >> "$outputFile" 2>&1
 }
+for configurationIndex in "${!configurationNames[@]}" ; do
+configuration="${configurationNames[$configurationIndex]}"
+if [[ -n "$configurationFilter" && "$configuration" != "$configurationFilter" ]] ; then
+    continue
+fi
+#intentionally unquoted where used, it holds several flags
+configurationFlag="${configurationFlags[$configurationIndex]}"
+if [[ "$configuration" == "default" ]]
+then configurationSuffix=""
+else configurationSuffix="-$configuration"
+fi
 for instance in $(eval ls $instanceFilter) ; do
     for param in instances/$(basename "$instance" .essence)*.param ; do
         ((numberInstances += 1))
         if [[ "$param" == "instances/$(basename "$instance" .essence)*.param" ]] ; then
             withParam=0
-            echo "Running test $instance with seed $seed"
-            outputDir="output/$(basename "$instance" .essence)-$seed"
+            echo "Running test $instance ($configuration) with seed $seed"
+            outputDir="output/$(basename "$instance" .essence)$configurationSuffix-$seed"
             mkdir -p "$outputDir"
             numberIterations=$(grep -E '^\$testing:numberIterations=' "$instance" | grep -Eo '[0-9]+')
-            runCommand "$outputDir/solver-output.txt" "$solver" $disableDebugLogFlag --sanity-check --at-intervals-of $sanityCheckIntervals --dont-skip-repeat-visits --random-seed $seed --iteration-limit $numberIterations  --spec "$instance" 
+            runCommand "$outputDir/solver-output.txt" "$solver" $disableDebugLogFlag $configurationFlag --sanity-check --at-intervals-of $sanityCheckIntervals --dont-skip-repeat-visits --random-seed $seed --iteration-limit $numberIterations  --spec "$instance" 
         else
             withParam=1
-            echo "Running test $instance with param $param with seed $seed"
-            outputDir="output/$(basename "$instance" .essence)-$(basename "$param" .param)-$seed"
+            echo "Running test $instance with param $param ($configuration) with seed $seed"
+            outputDir="output/$(basename "$instance" .essence)-$(basename "$param" .param)$configurationSuffix-$seed"
             mkdir -p "$outputDir"
             numberIterations=$(grep -E '^\$testing:numberIterations=' "$param" | grep -Eo '[0-9]+')
-            runCommand "$outputDir/solver-output.txt" "$solver" $disableDebugLogFlag --sanity-check --at-intervals-of $sanityCheckIntervals  --dont-skip-repeat-visits --random-seed $seed --iteration-limit $numberIterations  --spec "$instance" --param "$param" 
+            runCommand "$outputDir/solver-output.txt" "$solver" $disableDebugLogFlag $configurationFlag --sanity-check --at-intervals-of $sanityCheckIntervals  --dont-skip-repeat-visits --random-seed $seed --iteration-limit $numberIterations  --spec "$instance" --param "$param" 
         fi
         exitStatus=$?
         checkExitStatus &&
@@ -163,6 +187,7 @@ for instance in $(eval ls $instanceFilter) ; do
         markPassed "$outputDir"    
     done
 done
+done
 
 if (( failedInstances > 0 )); then
     echo "Number of failed instances: $failedInstances" 1>&2 